@@ -0,0 +1,184 @@
+#include "AssetBundle.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const char MAGIC[4] = {'D', 'S', 'A', 'B'};
+    const size_t BLOB_ALIGNMENT = 64;
+
+    size_t alignUp(size_t value) {
+        return (value + BLOB_ALIGNMENT - 1) / BLOB_ALIGNMENT * BLOB_ALIGNMENT;
+    }
+}
+
+AssetBundle::AssetBundle() : m_data(nullptr), m_size(0), m_entries(nullptr), m_entryCount(0) {}
+
+AssetBundle::~AssetBundle() {
+    close();
+}
+
+bool AssetBundle::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    // No mmap here; read the file in one go instead
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) return false;
+    m_size = (size_t)in.tellg();
+    unsigned char* buffer = new unsigned char[m_size];
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(buffer), m_size);
+    m_data = buffer;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    m_size = (size_t)info.st_size;
+    void* mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping keeps the file alive
+    if (mapping == MAP_FAILED) {
+        std::cerr << "Unable to map asset bundle " << path << std::endl;
+        m_size = 0;
+        return false;
+    }
+    m_data = static_cast<const unsigned char*>(mapping);
+#endif
+
+    // Validate everything up front so lookups can trust the offsets
+    Header header;
+    bool valid = m_size >= sizeof(Header);
+    if (valid) {
+        std::memcpy(&header, m_data, sizeof(header));
+        valid = std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 && header.version == VERSION &&
+                (m_size - sizeof(Header)) / sizeof(Entry) >= header.entryCount;
+    }
+    if (valid) {
+        m_entries = reinterpret_cast<const Entry*>(m_data + sizeof(Header));
+        m_entryCount = header.entryCount;
+        for (Uint32 i = 0; i < m_entryCount && valid; ++i) {
+            // Written so no sum or product can wrap on a corrupt file
+            const Entry& entry = m_entries[i];
+            valid = entry.pixelOffset <= m_size && entry.pixelSize <= m_size - entry.pixelOffset &&
+                    entry.metricsOffset <= m_size && entry.metricsSize <= m_size - entry.metricsOffset &&
+                    entry.width > 0 && entry.height > 0 && entry.pitch > 0 &&
+                    (Uint64)entry.pitch >= (Uint64)entry.width * 4 &&
+                    (Uint64)entry.pitch * (Uint64)entry.height <= entry.pixelSize &&
+                    std::memchr(entry.name, '\0', sizeof(entry.name)) != nullptr;
+        }
+    }
+    if (!valid) {
+        std::cerr << "Asset bundle " << path << " is invalid or from another version; ignoring it" << std::endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void AssetBundle::close() {
+    if (m_data) {
+#ifdef _WIN32
+        delete[] m_data;
+#else
+        munmap(const_cast<unsigned char*>(m_data), m_size);
+#endif
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_entries = nullptr;
+    m_entryCount = 0;
+}
+
+const AssetBundle::Entry* AssetBundle::find(const std::string& name) const {
+    for (Uint32 i = 0; i < m_entryCount; ++i) {
+        if (name == m_entries[i].name) return &m_entries[i];
+    }
+    return nullptr;
+}
+
+void AssetBundleWriter::addImage(const std::string& name, const SDL_Surface* surface, int frameWidth, int frameHeight,
+                                 const std::vector<char>& frameTable) {
+    add(name, AssetBundle::Kind::IMAGE, surface, frameWidth, frameHeight, frameTable);
+}
+
+void AssetBundleWriter::addGlyphAtlas(const std::string& name, const SDL_Surface* surface, const std::vector<char>& metrics) {
+    add(name, AssetBundle::Kind::GLYPH_ATLAS, surface, 0, 0, metrics);
+}
+
+void AssetBundleWriter::add(const std::string& name, AssetBundle::Kind kind, const SDL_Surface* surface,
+                            int frameWidth, int frameHeight, const std::vector<char>& metrics) {
+    Pending pending;
+    std::memset(&pending.entry, 0, sizeof(pending.entry));
+    std::strncpy(pending.entry.name, name.c_str(), sizeof(pending.entry.name) - 1);
+    pending.entry.kind = kind;
+    pending.entry.width = surface->w;
+    pending.entry.height = surface->h;
+    pending.entry.pitch = surface->pitch;
+    pending.entry.frameWidth = frameWidth;
+    pending.entry.frameHeight = frameHeight;
+
+    const char* pixels = static_cast<const char*>(surface->pixels);
+    pending.pixels.assign(pixels, pixels + (size_t)surface->pitch * surface->h);
+    pending.metrics = metrics;
+    m_pending.push_back(pending);
+}
+
+bool AssetBundleWriter::write(const std::string& path) const {
+    // Lay out the blobs after the entry table, then fill in their offsets
+    std::vector<AssetBundle::Entry> entries;
+    size_t offset = alignUp(sizeof(AssetBundle::Header) + m_pending.size() * sizeof(AssetBundle::Entry));
+    for (const Pending& pending : m_pending) {
+        AssetBundle::Entry entry = pending.entry;
+        entry.pixelOffset = offset;
+        entry.pixelSize = pending.pixels.size();
+        offset = alignUp(offset + pending.pixels.size());
+        entry.metricsOffset = offset;
+        entry.metricsSize = pending.metrics.size();
+        offset = alignUp(offset + pending.metrics.size());
+        entries.push_back(entry);
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        std::cerr << "Unable to open " << path << " for writing" << std::endl;
+        return false;
+    }
+
+    AssetBundle::Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = AssetBundle::VERSION;
+    header.entryCount = (Uint32)entries.size();
+    header.reserved = 0;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(AssetBundle::Entry));
+
+    const std::vector<char> padding(BLOB_ALIGNMENT, 0);
+    auto padTo = [&](size_t position) {
+        size_t written = (size_t)out.tellp();
+        out.write(padding.data(), position - written);
+    };
+    for (size_t i = 0; i < entries.size(); ++i) {
+        padTo(entries[i].pixelOffset);
+        out.write(m_pending[i].pixels.data(), m_pending[i].pixels.size());
+        padTo(entries[i].metricsOffset);
+        out.write(m_pending[i].metrics.data(), m_pending[i].metrics.size());
+    }
+    padTo(offset);
+
+    if (!out) {
+        std::cerr << "Failed writing asset bundle " << path << std::endl;
+        return false;
+    }
+    return true;
+}
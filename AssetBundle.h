@@ -0,0 +1,88 @@
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+
+// One file holding assets already in their GPU upload format: colour-keyed
+// ARGB8888 pixels for images (sprite sheets packed, with their frame table),
+// and pixels plus layout metrics for glyph atlases.
+// At runtime the file is memory-mapped and textures upload straight from the
+// mapping, so nothing is decoded or copied on our side.
+//
+// Layout: Header, then Header::entryCount Entry records, then the blobs they
+// point at, each 64-byte aligned. Fields are native-endian; a bundle is baked
+// for the platform that loads it.
+class AssetBundle {
+public:
+    static const Uint32 VERSION = 2;
+
+    enum class Kind : Uint32 { IMAGE = 1, GLYPH_ATLAS = 2 };
+
+    struct Header {
+        char magic[4];       // "DSAB"
+        Uint32 version;
+        Uint32 entryCount;
+        Uint32 reserved;
+    };
+
+    struct Entry {
+        char name[64];       // Images use their source path, so texture cache keys match
+        Kind kind;
+        Sint32 width;
+        Sint32 height;
+        Sint32 pitch;
+        Sint32 frameWidth;   // Animation frame size for sprite sheets, 0 otherwise
+        Sint32 frameHeight;
+        Uint64 pixelOffset;
+        Uint64 pixelSize;
+        Uint64 metricsOffset;  // GlyphAtlas::writeMetrics or SpriteAtlas::writeFrames blob
+        Uint64 metricsSize;
+    };
+
+    AssetBundle();
+    ~AssetBundle();
+
+    AssetBundle(const AssetBundle&) = delete;
+    AssetBundle& operator=(const AssetBundle&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return m_data != nullptr; }
+
+    const Entry* find(const std::string& name) const;
+    const void* getPixels(const Entry& entry) const { return m_data + entry.pixelOffset; }
+    const void* getMetrics(const Entry& entry) const { return m_data + entry.metricsOffset; }
+
+private:
+    const unsigned char* m_data;
+    size_t m_size;
+    const Entry* m_entries;
+    Uint32 m_entryCount;
+};
+
+// Collects entries in memory and writes them out as a bundle (offline bake step)
+class AssetBundleWriter {
+public:
+    // surface must be SDL_PIXELFORMAT_ARGB8888
+    void addImage(const std::string& name, const SDL_Surface* surface, int frameWidth = 0, int frameHeight = 0,
+                  const std::vector<char>& frameTable = std::vector<char>());
+    void addGlyphAtlas(const std::string& name, const SDL_Surface* surface, const std::vector<char>& metrics);
+
+    bool write(const std::string& path) const;
+
+private:
+    struct Pending {
+        AssetBundle::Entry entry;
+        std::vector<char> pixels;
+        std::vector<char> metrics;
+    };
+
+    void add(const std::string& name, AssetBundle::Kind kind, const SDL_Surface* surface,
+             int frameWidth, int frameHeight, const std::vector<char>& metrics);
+
+    std::vector<Pending> m_pending;
+};
+
+#endif
@@ -0,0 +1,125 @@
+#include "AssetLoader.h"
+#include "LTexture.h"
+#include "Renderer.h"
+#include "TextureCache.h"
+#include <algorithm>
+
+AssetLoader::AssetLoader()
+    : m_nextJob(0), m_decodedJobs(0), m_uploadedImages(0), m_imageJobs(0) {}
+
+AssetLoader::~AssetLoader() {
+    for (auto& thread : m_workers) {
+        thread.join();
+    }
+    for (Job& job : m_jobs) {
+        if (job.surface) SDL_FreeSurface(job.surface);
+    }
+}
+
+void AssetLoader::queueImage(const std::string& path) {
+    Job job;
+    job.path = path;
+    m_jobs.push_back(job);
+    ++m_imageJobs;
+}
+
+void AssetLoader::queueSpriteSheet(const std::string& path, int cellWidth, int cellHeight) {
+    queueImage(path);
+    m_jobs.back().cellWidth = cellWidth;
+    m_jobs.back().cellHeight = cellHeight;
+}
+
+void AssetLoader::queueFontFile() {
+    Job job;
+    job.kind = JobKind::FONT_FILE;
+    m_jobs.push_back(job);
+}
+
+void AssetLoader::start(int threads) {
+    int threadCount = std::min(std::max(1, threads), std::max(1, (int)m_jobs.size()));
+    for (int t = 0; t < threadCount; ++t) {
+        m_workers.emplace_back(&AssetLoader::runWorker, this);
+    }
+}
+
+void AssetLoader::runWorker() {
+    // Jobs are claimed by index; m_jobs itself is not resized once workers run
+    for (size_t index = m_nextJob++; index < m_jobs.size(); index = m_nextJob++) {
+        Job& job = m_jobs[index];
+        SDL_Surface* surface = nullptr;
+        std::vector<SpriteFrame> frames;
+        std::vector<char> bytes;
+
+        if (job.kind == JobKind::IMAGE) {
+            surface = LTexture::decodeFile(job.path);
+            if (surface && job.cellWidth > 0) {
+                SDL_Surface* atlas = SpriteAtlas::pack(surface, job.cellWidth, job.cellHeight, frames);
+                SDL_FreeSurface(surface);
+                surface = atlas;
+            }
+        } else {
+            Renderer::readFontFile(bytes);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_jobMutex);
+            job.surface = surface;
+            job.frames.swap(frames);
+            job.bytes.swap(bytes);
+            job.decoded = true;
+        }
+        ++m_decodedJobs;
+    }
+}
+
+void AssetLoader::uploadReady(TextureCache& cache) {
+    std::lock_guard<std::mutex> lock(m_jobMutex);
+    for (Job& job : m_jobs) {
+        if (job.kind != JobKind::IMAGE || !job.decoded || job.uploaded) continue;
+
+        // A failed decode still counts as handled; users fall back as they would on a failed load
+        if (job.surface) {
+            if (!cache.insert(job.path, job.surface)) job.frames.clear();
+            SDL_FreeSurface(job.surface);
+            job.surface = nullptr;
+        }
+        job.uploaded = true;
+        ++m_uploadedImages;
+    }
+}
+
+bool AssetLoader::isDone() const {
+    std::lock_guard<std::mutex> lock(m_jobMutex);
+    return m_decodedJobs == m_jobs.size() && m_uploadedImages == m_imageJobs;
+}
+
+float AssetLoader::getProgress() const {
+    if (m_jobs.empty()) return 1.0f;
+    std::lock_guard<std::mutex> lock(m_jobMutex);
+    // Decoding and uploading each count as half of an image's work; a font file is one step
+    float finished = (float)m_decodedJobs + (float)m_uploadedImages;
+    return finished / (float)(m_jobs.size() + m_imageJobs);
+}
+
+bool AssetLoader::takeFrames(const std::string& path, std::vector<SpriteFrame>& frames) {
+    std::lock_guard<std::mutex> lock(m_jobMutex);
+    for (Job& job : m_jobs) {
+        if (job.kind == JobKind::IMAGE && job.path == path && job.uploaded && !job.frames.empty()) {
+            frames.swap(job.frames);
+            job.frames.clear();
+            return true;
+        }
+    }
+    return false;
+}
+
+void AssetLoader::takeFontData(std::vector<char>& data) {
+    std::lock_guard<std::mutex> lock(m_jobMutex);
+    data.clear();
+    for (Job& job : m_jobs) {
+        if (job.kind == JobKind::FONT_FILE && job.decoded && !job.bytes.empty()) {
+            data.swap(job.bytes);
+            return;
+        }
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include <SDL2/SDL.h>
+#include "SpriteAtlas.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TextureCache;
+
+// Decodes images and reads the font file on worker threads while the render
+// thread keeps drawing. Only the texture upload happens on the render thread,
+// in uploadReady(), which is meant to be called once per frame until isDone().
+// Fonts come back as raw bytes: SDL_ttf is not documented as thread-safe, so
+// the Renderer opens them from memory on the main thread.
+class AssetLoader {
+public:
+    AssetLoader();
+    ~AssetLoader();  // Waits for the workers and frees anything not handed over
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // Queue work before start()
+    void queueImage(const std::string& path);
+    // A grid sprite sheet, packed into a trimmed atlas on the worker (see SpriteAtlas)
+    void queueSpriteSheet(const std::string& path, int cellWidth, int cellHeight);
+    void queueFontFile();   // Renderer::readFontFile
+
+    void start(int threads = 2);
+
+    // Uploads every image decoded so far into the cache (render thread only)
+    void uploadReady(TextureCache& cache);
+
+    bool isDone() const;       // Every job decoded and every image uploaded
+    float getProgress() const; // Fraction of jobs finished, for the loading screen
+
+    // Frame table of a packed sprite sheet once done; false if it failed to load
+    bool takeFrames(const std::string& path, std::vector<SpriteFrame>& frames);
+
+    // Hands over the font file once done; empty if none was found
+    void takeFontData(std::vector<char>& data);
+
+private:
+    enum class JobKind { IMAGE, FONT_FILE };
+
+    struct Job {
+        JobKind kind = JobKind::IMAGE;
+        std::string path;
+        int cellWidth = 0;    // Non-zero for sprite sheets
+        int cellHeight = 0;
+        SDL_Surface* surface = nullptr;
+        std::vector<SpriteFrame> frames;
+        std::vector<char> bytes;  // Font file contents
+        bool decoded = false;
+        bool uploaded = false;
+    };
+
+    void runWorker();
+
+    std::vector<Job> m_jobs;
+    std::vector<std::thread> m_workers;
+    std::atomic<size_t> m_nextJob;
+    std::atomic<size_t> m_decodedJobs;
+    size_t m_uploadedImages;
+    size_t m_imageJobs;
+    mutable std::mutex m_jobMutex;   // Guards each Job's results
+};
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef ATTACK_TABLE_H
+#define ATTACK_TABLE_H
+
+#include <SDL2/SDL.h>
+#include <cmath>
+#include "Boss.h"
+#include "Goals.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Everything that distinguishes one attack from another, in one place.
+// Adding an attack is a row here; the static_asserts at the bottom reject a
+// table that is missing a row, out of order, or inconsistent.
+namespace AttackTable {
+    // How the sword angle moves over one phase of an attack
+    enum class CurveKind {
+        LINEAR,  // start + sweep * progress, optionally held at start for the first part
+        SPIN,    // Adds turns full circles over the phase, from wherever the windup left it
+        WOBBLE   // start plus a small oscillation driven by the remaining time
+    };
+
+    // Side 0 is the sword on the boss's right, side 1 on the left. Angles in
+    // radians; SwordMotion bakes these into lookup tables on first use.
+    struct SwordCurve {
+        CurveKind kind;
+        double start[2];
+        double sweep[2];
+        float hold;      // Progress spent at start before sweeping (LINEAR only)
+        double turns;    // SPIN only
+    };
+
+    // Which shape getAttackCircle reports while the attack is live
+    enum class HitShape {
+        TIP_CIRCLE,  // Around the sword tip, of hitRadius
+        BODY_CIRCLE  // Around the boss, of sword length plus hitRadius
+    };
+
+    struct AnimDef {
+        BossAttackAnim anim;
+        float windup;             // Seconds of telegraph before the swing
+        float duration;           // Seconds of the swing itself
+        float damageMultiplier;   // Applied to the boss's base attack damage
+        SwordCurve windupCurve;
+        SwordCurve swingCurve;
+        HitShape hitShape;
+        float hitRadius;
+        bool swapsSide;           // Sword ends the swing on the other side
+        SDL_Color debugColor;     // Indicator drawn by the debug overlay
+    };
+
+    struct AttackDef {
+        AttackType type;
+        const char* name;   // Short name for logs and batch reports
+        BossAttackAnim anim;
+    };
+
+    constexpr SwordCurve linear(double startRight, double sweepRight, double startLeft, double sweepLeft) {
+        return SwordCurve{CurveKind::LINEAR, {startRight, startLeft}, {sweepRight, sweepLeft}, 0.0f, 0.0};
+    }
+    constexpr SwordCurve linear(double start, double sweep) {
+        return linear(start, sweep, start, sweep);
+    }
+    constexpr SwordCurve held(double start, double sweep, float hold) {
+        return SwordCurve{CurveKind::LINEAR, {start, start}, {sweep, sweep}, hold, 0.0};
+    }
+    constexpr SwordCurve fixed(double right, double left) {
+        return linear(right, 0.0, left, 0.0);
+    }
+    constexpr SwordCurve spin(double turns) {
+        return SwordCurve{CurveKind::SPIN, {0.0, 0.0}, {0.0, 0.0}, 0.0f, turns};
+    }
+    constexpr SwordCurve wobble(double start) {
+        return SwordCurve{CurveKind::WOBBLE, {start, start}, {0.0, 0.0}, 0.0f, 0.0};
+    }
+
+    // Indexed by BossAttackAnim
+    constexpr AnimDef ANIMS[] = {
+        {BossAttackAnim::HORIZONTAL_SWING, 0.7f, 0.4f, 1.0f,
+         linear(0.0, -M_PI * 0.3f, M_PI, M_PI * 0.3f),
+         linear(-M_PI * 0.3f, M_PI * 1.3f, M_PI * 1.3f, -(M_PI * 1.3f)),
+         HitShape::TIP_CIRCLE, 30.0f, true, {173, 216, 230, 255}},   // Light Blue
+        {BossAttackAnim::SPIN_ATTACK, 0.8f, 0.8f, 1.2f,
+         linear(0.0, -M_PI * 0.2f),                                   // Slight pullback before spin
+         spin(2.0),
+         HitShape::BODY_CIRCLE, 40.0f, false, {0, 255, 255, 255}},    // Cyan
+        {BossAttackAnim::OVERHEAD_SWING, 0.9f, 0.5f, 1.5f,
+         linear(0.0, -M_PI * 0.8f),
+         linear(-M_PI * 0.8f, M_PI * 1.3f),
+         HitShape::TIP_CIRCLE, 30.0f, false, {255, 0, 255, 255}},     // Magenta
+        {BossAttackAnim::UPPERCUT, 0.7f, 0.4f, 1.3f,
+         linear(0.0, M_PI * 0.4f),
+         linear(M_PI * 0.4f, -(M_PI * 0.9f)),
+         HitShape::TIP_CIRCLE, 30.0f, false, {255, 165, 0, 255}},     // Orange
+        {BossAttackAnim::GROUND_SLAM, 1.0f, 0.6f, 1.8f,
+         linear(0.0, -M_PI * 0.8f),
+         held(-M_PI * 0.8f, M_PI * 1.3f, 0.3f),                       // Stay raised, then slam down
+         HitShape::TIP_CIRCLE, 30.0f, false, {165, 42, 42, 255}},     // Brown
+        {BossAttackAnim::DASH_ATTACK, 0.6f, 0.4f, 1.0f,               // Quick wind-up for dash
+         linear(0.0, -M_PI * 0.2f),
+         fixed(-M_PI * 0.2f, M_PI * 1.2f),
+         HitShape::TIP_CIRCLE, 30.0f, false, {255, 192, 203, 255}},   // Pink
+        {BossAttackAnim::PROJECTILE, 1.0f, 0.5f, 0.8f,                // Long wind-up for projectile
+         linear(0.0, -M_PI * 0.2f),
+         wobble(-M_PI * 0.4f),
+         HitShape::TIP_CIRCLE, 30.0f, false, {0, 255, 0, 255}},       // Lime
+        {BossAttackAnim::BACKSTEP_SLASH, 0.6f, 0.4f, 1.1f,
+         linear(0.0, -M_PI * 0.2f),
+         fixed(M_PI * 0.3f, M_PI * 0.7f),
+         HitShape::TIP_CIRCLE, 30.0f, false, {0, 128, 128, 255}},     // Teal
+    };
+
+    // AttackType values come in two blocks taken from the scripts: 3000.. for
+    // the base moveset and 13000.. for the enhanced state (13001 is unused)
+    constexpr int BASE_ATTACKS = 12;
+    constexpr int attackIndex(AttackType type) {
+        return static_cast<int>(type) < 13000 ? static_cast<int>(type) - 3000
+             : static_cast<int>(type) == 13000 ? BASE_ATTACKS
+             : BASE_ATTACKS + 1 + (static_cast<int>(type) - 13002);
+    }
+
+    // Indexed by attackIndex
+    constexpr AttackDef ATTACKS[] = {
+        {AttackType::LIGHT_COMBO_1, "Light1", BossAttackAnim::HORIZONTAL_SWING},
+        {AttackType::LIGHT_COMBO_2, "Light2", BossAttackAnim::HORIZONTAL_SWING},
+        {AttackType::LIGHT_COMBO_3, "Light3", BossAttackAnim::HORIZONTAL_SWING},
+        {AttackType::DASH_ATTACK, "Dash", BossAttackAnim::DASH_ATTACK},
+        {AttackType::DASH_FOLLOWUP, "DashFollow", BossAttackAnim::DASH_ATTACK},
+        {AttackType::SPIN_ATTACK, "Spin", BossAttackAnim::SPIN_ATTACK},
+        {AttackType::UPPERCUT, "Uppercut", BossAttackAnim::UPPERCUT},
+        {AttackType::BACKSTEP_SLASH_R, "BackslashR", BossAttackAnim::BACKSTEP_SLASH},
+        {AttackType::BACKSTEP_SLASH_L, "BackslashL", BossAttackAnim::BACKSTEP_SLASH},
+        {AttackType::GROUND_SLAM, "Slam", BossAttackAnim::GROUND_SLAM},
+        {AttackType::GROUND_SLAM_FOLLOWUP, "SlamFollow", BossAttackAnim::GROUND_SLAM},
+        {AttackType::PROJECTILE, "Projectile", BossAttackAnim::PROJECTILE},
+        {AttackType::ENHANCED_COMBO_1, "EnhCombo1", BossAttackAnim::HORIZONTAL_SWING},
+        {AttackType::ENHANCED_COMBO_2, "EnhCombo2", BossAttackAnim::GROUND_SLAM},
+        {AttackType::ENHANCED_SPIN_R, "EnhSpinR", BossAttackAnim::SPIN_ATTACK},
+        {AttackType::ENHANCED_SPIN_L, "EnhSpinL", BossAttackAnim::SPIN_ATTACK},
+    };
+
+    constexpr int ANIM_COUNT = sizeof(ANIMS) / sizeof(ANIMS[0]);
+    constexpr int ATTACK_COUNT = sizeof(ATTACKS) / sizeof(ATTACKS[0]);
+
+    inline const AnimDef& anim(BossAttackAnim anim) { return ANIMS[static_cast<int>(anim)]; }
+    inline const AttackDef& attack(AttackType type) { return ATTACKS[attackIndex(type)]; }
+    inline bool isKnown(AttackType type) {
+        int index = attackIndex(type);
+        return index >= 0 && index < ATTACK_COUNT && ATTACKS[index].type == type;
+    }
+
+    // Compile-time checks over the rows
+    constexpr bool curveValid(const SwordCurve& curve) {
+        return curve.hold >= 0.0f && curve.hold < 1.0f &&
+               (curve.kind != CurveKind::SPIN || curve.turns > 0.0);
+    }
+
+    constexpr bool animsValid() {
+        for (int i = 0; i < ANIM_COUNT; ++i) {
+            const AnimDef& def = ANIMS[i];
+            if (static_cast<int>(def.anim) != i) return false;
+            if (def.windup <= 0.0f || def.duration <= 0.0f || def.damageMultiplier <= 0.0f) return false;
+            if (def.hitRadius <= 0.0f) return false;
+            if (!curveValid(def.windupCurve) || !curveValid(def.swingCurve)) return false;
+            if (def.windupCurve.kind != CurveKind::LINEAR) return false;  // Windup is always progress-driven
+        }
+        return true;
+    }
+
+    constexpr bool attacksValid() {
+        for (int i = 0; i < ATTACK_COUNT; ++i) {
+            const AttackDef& def = ATTACKS[i];
+            if (attackIndex(def.type) != i) return false;
+            if (def.name == nullptr || def.name[0] == '\0') return false;
+            if (static_cast<int>(def.anim) < 0 || static_cast<int>(def.anim) >= ANIM_COUNT) return false;
+        }
+        return true;
+    }
+
+    static_assert(ANIM_COUNT == static_cast<int>(BossAttackAnim::COUNT), "Every BossAttackAnim needs a row");
+    static_assert(animsValid(), "Anim rows must be in BossAttackAnim order with positive timings");
+    static_assert(ATTACK_COUNT == attackIndex(AttackType::ENHANCED_SPIN_L) + 1, "Every AttackType needs a row");
+    static_assert(attacksValid(), "Attack rows must be in attackIndex order and name a valid anim");
+}
+
+#endif
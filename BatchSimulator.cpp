@@ -0,0 +1,132 @@
+#include "BatchSimulator.h"
+#include "Game.h"
+#include "Player.h"
+#include "Boss.h"
+#include "Sif.h"
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+void BatchStats::add(const FightResult& result) {
+    ++fights;
+    if (result.playerWon) {
+        ++playerWins;
+        totalTimeToKill += result.duration;
+    }
+    if (result.timedOut) {
+        ++timeouts;
+    }
+    totalDuration += result.duration;
+    totalDamageTaken += result.damageTaken;
+    totalDamageDealt += result.damageDealt;
+    for (const auto& entry : result.attackCounts) {
+        attackCounts[entry.first] += entry.second;
+    }
+}
+
+void BatchStats::merge(const BatchStats& other) {
+    fights += other.fights;
+    playerWins += other.playerWins;
+    timeouts += other.timeouts;
+    totalDuration += other.totalDuration;
+    totalTimeToKill += other.totalTimeToKill;
+    totalDamageTaken += other.totalDamageTaken;
+    totalDamageDealt += other.totalDamageDealt;
+    for (const auto& entry : other.attackCounts) {
+        attackCounts[entry.first] += entry.second;
+    }
+}
+
+BatchSimulator::BatchSimulator(int fights, int threads, unsigned int baseSeed,
+                               float fixedStep, PlayerBot::Style botStyle)
+    : m_fights(fights), m_threads(std::max(1, threads)), m_baseSeed(baseSeed),
+      m_fixedStep(fixedStep), m_botStyle(botStyle) {}
+
+FightResult BatchSimulator::runFight(unsigned int seed, float fixedStep, PlayerBot::Style botStyle) {
+    const int ARENA_WIDTH = 800;
+    const int ARENA_HEIGHT = 600;
+
+    Game game;
+    game.initHeadless(ARENA_WIDTH, ARENA_HEIGHT, seed);
+
+    // Decorrelate the bot's stream from the AI's
+    PlayerBot bot(botStyle, seed ^ 0x9E3779B9u);
+
+    const Player* player = game.getPlayer();
+    const Boss* boss = game.getBoss();
+
+    FightResult result;
+    const long long maxTicks = (long long)(MAX_FIGHT_SECONDS / fixedStep);
+    long long tick = 0;
+    while (!game.isFightOver() && tick < maxTicks) {
+        game.setPlayerInput(bot.think(*player, *boss, fixedStep));
+        game.update(fixedStep);
+        ++tick;
+    }
+
+    result.playerWon = !boss->isAlive() && player->isAlive();
+    result.timedOut = !game.isFightOver();
+    result.duration = tick * fixedStep;
+    result.damageTaken = player->getMaxHealth() - player->getHealth();
+    result.damageDealt = boss->getMaxHealth() - boss->getHealth();
+    result.attackCounts = game.getAI()->getAttackCounts();
+    return result;
+}
+
+BatchStats BatchSimulator::run() {
+    BatchStats total;
+    std::mutex totalMutex;
+    std::atomic<int> nextFight(0);
+
+    auto worker = [&]() {
+        BatchStats local;
+        for (int i = nextFight++; i < m_fights; i = nextFight++) {
+            local.add(runFight(m_baseSeed + (unsigned int)i, m_fixedStep, m_botStyle));
+        }
+        std::lock_guard<std::mutex> lock(totalMutex);
+        total.merge(local);
+    };
+
+    std::vector<std::thread> workers;
+    int threadCount = std::min(m_threads, std::max(1, m_fights));
+    for (int t = 0; t < threadCount; ++t) {
+        workers.emplace_back(worker);
+    }
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    return total;
+}
+
+void BatchSimulator::printReport(const BatchStats& stats, double wallSeconds) {
+    double fights = std::max(1, stats.fights);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "=== Batch Simulation ===" << std::endl;
+    std::cout << "Fights:            " << stats.fights << std::endl;
+    std::cout << "Player win rate:   " << 100.0 * stats.playerWins / fights << "%" << std::endl;
+    std::cout << "Timeouts:          " << stats.timeouts << std::endl;
+    std::cout << "Avg fight length:  " << stats.totalDuration / fights << " s" << std::endl;
+    if (stats.playerWins > 0) {
+        std::cout << "Avg time-to-kill:  " << stats.totalTimeToKill / stats.playerWins << " s" << std::endl;
+    } else {
+        std::cout << "Avg time-to-kill:  n/a (no wins)" << std::endl;
+    }
+    std::cout << "Avg damage taken:  " << stats.totalDamageTaken / fights << std::endl;
+    std::cout << "Avg damage dealt:  " << stats.totalDamageDealt / fights << std::endl;
+
+    std::cout << "Attack goals (total / per fight):" << std::endl;
+    for (const auto& entry : stats.attackCounts) {
+        std::cout << "  " << std::left << std::setw(12) << HolySwordWolfAI::attackTypeToString(entry.first)
+                  << std::right << std::setw(10) << entry.second
+                  << std::setw(10) << entry.second / fights << std::endl;
+    }
+
+    std::cout << "Wall time:         " << wallSeconds << " s" << std::endl;
+    std::cout << "Fights/sec:        " << (wallSeconds > 0 ? stats.fights / wallSeconds : 0.0) << std::endl;
+}
@@ -0,0 +1,56 @@
+#ifndef BATCHSIMULATOR_H
+#define BATCHSIMULATOR_H
+
+#include <map>
+#include "Goals.h"
+#include "PlayerBot.h"
+
+// Outcome of one headless fight
+struct FightResult {
+    bool playerWon = false;
+    bool timedOut = false;
+    float duration = 0.0f;      // Simulated seconds until one side died (or the time limit)
+    float damageTaken = 0.0f;   // By the player
+    float damageDealt = 0.0f;   // To the boss
+    std::map<AttackType, int> attackCounts;
+};
+
+// Totals over a batch of fights
+struct BatchStats {
+    int fights = 0;
+    int playerWins = 0;
+    int timeouts = 0;
+    double totalDuration = 0.0;
+    double totalTimeToKill = 0.0;  // Summed over player wins only
+    double totalDamageTaken = 0.0;
+    double totalDamageDealt = 0.0;
+    std::map<AttackType, long long> attackCounts;
+
+    void add(const FightResult& result);
+    void merge(const BatchStats& other);
+};
+
+// Runs independent Player-vs-Sif fights in parallel, each with its own Game,
+// bot and seed. Fight i always uses seed baseSeed + i, so results do not
+// depend on the thread count.
+class BatchSimulator {
+public:
+    BatchSimulator(int fights, int threads, unsigned int baseSeed,
+                   float fixedStep, PlayerBot::Style botStyle);
+
+    BatchStats run();
+
+    static FightResult runFight(unsigned int seed, float fixedStep, PlayerBot::Style botStyle);
+    static void printReport(const BatchStats& stats, double wallSeconds);
+
+    static constexpr float MAX_FIGHT_SECONDS = 300.0f;
+
+private:
+    int m_fights;
+    int m_threads;
+    unsigned int m_baseSeed;
+    float m_fixedStep;
+    PlayerBot::Style m_botStyle;
+};
+
+#endif
@@ -0,0 +1,412 @@
+// Microbenchmarks for hot paths, run in isolation. Build and run with `make bench`.
+// Each result is one JSON object per line on stdout:
+//   {"name":"...","iterations":N,"ns_per_op":X}
+// Game code logs to std::cout, so that is redirected to stderr while benchmarking.
+// Correctness checks live in CollisionTest.cpp (`make test`).
+#include "Game.h"
+#include "Boss.h"
+#include "CollisionKernels.h"
+#include "GameUnits.h"
+#include "Player.h"
+#include "ProjectilePool.h"
+#include "SpatialHash.h"
+#include "Renderer.h"
+#include "Sif.h"
+#include <SDL2/SDL_ttf.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    struct BenchOptions {
+        std::string filter;
+        double minSeconds = 0.2;
+    };
+
+    // Stops the optimizer from discarding a computed value
+    template <typename T>
+    void keep(const T& value) {
+#if defined(__GNUC__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    // Runs op(iterations) with a growing iteration count until one batch takes
+    // at least minSeconds, then reports that batch
+    void runBench(const BenchOptions& options, std::ostream& results, const std::string& name,
+                  const std::function<void(long long)>& op) {
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos) return;
+
+        op(1);  // Warm caches and lazy initialisation
+
+        long long iterations = 1;
+        double seconds = 0.0;
+        while (true) {
+            Clock::time_point start = Clock::now();
+            op(iterations);
+            seconds = secondsSince(start);
+            if (seconds >= options.minSeconds || iterations >= (1LL << 40)) break;
+
+            // Aim a little past the target so the next batch usually ends the search
+            double scale = seconds > 0.0 ? options.minSeconds * 1.2 / seconds : 100.0;
+            iterations = (long long)(iterations * std::min(100.0, std::max(2.0, scale)));
+        }
+
+        results << "{\"name\":\"" << name << "\",\"iterations\":" << iterations
+                << ",\"ns_per_op\":" << std::fixed << std::setprecision(2)
+                << seconds * 1e9 / iterations << "}" << std::endl;
+        results << std::defaultfloat;
+    }
+
+    void benchCollision(const BenchOptions& options, std::ostream& results) {
+        // Cycle through a few layouts so the branches are not perfectly predicted
+        const SDL_Rect boxes[4] = {{385, 425, 30, 50}, {370, 90, 60, 120}, {400, 460, 30, 50}, {800, 900, 10, 10}};
+        const Circle circles[4] = {Circle(400, 150, 90), Circle(410, 440, 20), Circle(0, 0, 5), Circle(395, 500, 40)};
+
+        runBench(options, results, "checkCollision/rect_rect", [&](long long iterations) {
+            int hits = 0;
+            for (long long i = 0; i < iterations; ++i) {
+                hits += checkCollision(boxes[i & 3], boxes[(i + 1) & 3]);
+            }
+            keep(hits);
+        });
+
+        runBench(options, results, "checkCollision/circle_rect", [&](long long iterations) {
+            int hits = 0;
+            for (long long i = 0; i < iterations; ++i) {
+                hits += checkCollision(circles[i & 3], boxes[(i + 2) & 3]);
+            }
+            keep(hits);
+        });
+
+        // Batch kernels: one shape against 1024 packed candidates, one op per candidate
+        const int batch = 1024;
+        std::vector<int> xs(batch), ys(batch), ws(batch), hs(batch);
+        std::vector<float> cxs(batch), cys(batch);
+        std::vector<Uint32> hitMask(CollisionKernels::getMaskWords(batch));
+        for (int i = 0; i < batch; ++i) {
+            xs[i] = (i * 37) % 800;
+            ys[i] = (i * 91) % 600;
+            ws[i] = 10 + i % 50;
+            hs[i] = 10 + i % 70;
+            cxs[i] = GameUnits::toMeters((float)xs[i]);
+            cys[i] = GameUnits::toMeters((float)ys[i]);
+        }
+        std::cerr << "collision kernels: " << CollisionKernels::getBackend() << std::endl;
+
+        runBench(options, results, "CollisionKernels::boxVsBoxes/candidate", [&](long long iterations) {
+            for (long long done = 0; done < iterations; done += batch) {
+                CollisionKernels::boxVsBoxes(boxes[(done / batch) & 3], xs.data(), ys.data(), ws.data(), hs.data(),
+                                             batch, hitMask.data());
+                keep(hitMask[0]);
+            }
+        });
+
+        runBench(options, results, "CollisionKernels::circleVsBoxes/candidate", [&](long long iterations) {
+            for (long long done = 0; done < iterations; done += batch) {
+                const Circle& c = circles[(done / batch) & 3];
+                CollisionKernels::circleVsBoxes(c.x, c.y, c.r, xs.data(), ys.data(), ws.data(), hs.data(),
+                                                batch, hitMask.data());
+                keep(hitMask[0]);
+            }
+        });
+
+        runBench(options, results, "CollisionKernels::boxVsCircles/candidate", [&](long long iterations) {
+            for (long long done = 0; done < iterations; done += batch) {
+                const SDL_Rect& b = boxes[(done / batch) & 3];
+                CollisionKernels::boxVsCircles(GameUnits::toMeters((float)b.x), GameUnits::toMeters((float)b.y),
+                                               GameUnits::toMeters((float)(b.x + b.w)),
+                                               GameUnits::toMeters((float)(b.y + b.h)),
+                                               ProjectilePool::RADIUS, cxs.data(), cys.data(), batch, hitMask.data());
+                keep(hitMask[0]);
+            }
+        });
+
+        runBench(options, results, "separateEntities/overlapping", [&](long long iterations) {
+            for (long long i = 0; i < iterations; ++i) {
+                Vector2D a(13.3f, 15.0f);
+                Vector2D b(13.3f + (i & 7) * 0.1f, 14.0f);
+                separateEntities(a, b, 1.0f, 2.0f);
+                keep(a);
+                keep(b);
+            }
+        });
+
+        runBench(options, results, "separateEntities/apart", [&](long long iterations) {
+            for (long long i = 0; i < iterations; ++i) {
+                Vector2D a(5.0f, 5.0f);
+                Vector2D b(15.0f + (i & 7), 5.0f);
+                separateEntities(a, b, 1.0f, 2.0f);
+                keep(a);
+                keep(b);
+            }
+        });
+    }
+
+    void benchVector2D(const BenchOptions& options, std::ostream& results) {
+        runBench(options, results, "Vector2D/add_sub_scale", [&](long long iterations) {
+            Vector2D acc(0.0f, 0.0f);
+            Vector2D step(0.25f, -0.5f);
+            for (long long i = 0; i < iterations; ++i) {
+                acc = (acc + step) * 0.999f - Vector2D(0.001f, 0.002f);
+                keep(acc);
+            }
+        });
+
+        runBench(options, results, "Vector2D/length", [&](long long iterations) {
+            Vector2D v(3.0f, 4.0f);
+            float total = 0.0f;
+            for (long long i = 0; i < iterations; ++i) {
+                v.x += 0.001f;
+                total += v.length();
+                keep(total);
+            }
+        });
+
+        runBench(options, results, "Vector2D/normalized", [&](long long iterations) {
+            Vector2D v(3.0f, 4.0f);
+            for (long long i = 0; i < iterations; ++i) {
+                v.x += 0.001f;
+                Vector2D n = v.normalized();
+                keep(n);
+            }
+        });
+
+        runBench(options, results, "Vector2D/distance", [&](long long iterations) {
+            Vector2D a(1.0f, 2.0f);
+            Vector2D b(7.0f, -3.0f);
+            float total = 0.0f;
+            for (long long i = 0; i < iterations; ++i) {
+                a.y += 0.001f;
+                total += a.distance(b);
+                keep(total);
+            }
+        });
+    }
+
+    // selectAction picks weights by distance band, so bench each band with the
+    // player placed straight below the boss. The queued goals are cleared each
+    // iteration, so clearGoals is included in the figure.
+    void benchSelectAction(const BenchOptions& options, std::ostream& results) {
+        struct Band {
+            const char* name;
+            float distanceMeters;
+        };
+        const Band bands[] = {
+            {"very_close", 2.0f},   // <= 4
+            {"close", 5.0f},        // <= 6
+            {"mid_close", 7.0f},    // <= 8
+            {"mid_far", 10.0f},     // <= 12
+            {"far", 14.0f},         // > 12
+        };
+
+        for (const Band& band : bands) {
+            EntityStore entities;
+            Boss boss(entities, 400.0f, 150.0f);
+            Player player(entities, 400.0f, 150.0f + GameUnits::toPixels(band.distanceMeters));
+            HolySwordWolfAI ai(&boss, &player, 1);
+
+            runBench(options, results, std::string("HolySwordWolfAI::selectAction/") + band.name,
+                     [&](long long iterations) {
+                for (long long i = 0; i < iterations; ++i) {
+                    ai.selectAction();
+                    ai.clearGoals();
+                }
+            });
+        }
+    }
+
+    // One op is one 120 Hz animation step. The attack restarts whenever the boss
+    // returns to idle, so the figure averages wind-up, swing and recovery.
+    void benchBossAnimation(const BenchOptions& options, std::ostream& results) {
+        struct Anim {
+            const char* name;
+            BossAttackAnim anim;
+        };
+        const Anim anims[] = {
+            {"HORIZONTAL_SWING", BossAttackAnim::HORIZONTAL_SWING},
+            {"SPIN_ATTACK", BossAttackAnim::SPIN_ATTACK},
+            {"OVERHEAD_SWING", BossAttackAnim::OVERHEAD_SWING},
+            {"UPPERCUT", BossAttackAnim::UPPERCUT},
+            {"GROUND_SLAM", BossAttackAnim::GROUND_SLAM},
+            {"DASH_ATTACK", BossAttackAnim::DASH_ATTACK},
+            {"PROJECTILE", BossAttackAnim::PROJECTILE},
+            {"BACKSTEP_SLASH", BossAttackAnim::BACKSTEP_SLASH},
+        };
+        const float dt = 1.0f / 120.0f;
+
+        for (const Anim& anim : anims) {
+            EntityStore entities;
+            Boss boss(entities, 400.0f, 150.0f);
+
+            runBench(options, results, std::string("Boss::updateAnimation/") + anim.name,
+                     [&](long long iterations) {
+                for (long long i = 0; i < iterations; ++i) {
+                    if (boss.getAnimState() == BossAnimState::IDLE) {
+                        boss.startAttackAnimation(anim.anim);
+                    }
+                    boss.updateAnimation(dt);
+                }
+                keep(boss);
+            });
+        }
+    }
+
+    // One op is one 120 Hz tick of a full pool: move, expire, rebuild the broad
+    // phase, then resolve a player-sized box. Shots that leave or hit are
+    // respawned, so the pool stays full.
+    void benchProjectiles(const BenchOptions& options, std::ostream& results) {
+        const float dt = 1.0f / 120.0f;
+        const float arenaWidth = GameUnits::toMeters(800.0f);
+        const float arenaHeight = GameUnits::toMeters(600.0f);
+        const SDL_Rect playerBox = {385, 425, 30, 50};
+        ProjectilePool projectiles;
+        SpatialHash grid;
+        grid.setBounds(800, 600);
+        std::vector<int> candidates;
+        unsigned int seed = 1;
+
+        auto refill = [&]() {
+            while (projectiles.size() < ProjectilePool::CAPACITY) {
+                seed = seed * 1664525u + 1013904223u;
+                float angle = (seed >> 8) * (6.2831853f / 16777216.0f);
+                projectiles.spawn(Vector2D(arenaWidth / 2, arenaHeight / 4),
+                                  Vector2D(std::cos(angle) * 12.0f, std::sin(angle) * 12.0f),
+                                  20.0f, 3.0f, ProjectileOwner::BOSS);
+            }
+        };
+
+        runBench(options, results, "ProjectilePool::tick/4096", [&](long long iterations) {
+            for (long long i = 0; i < iterations; ++i) {
+                refill();
+                projectiles.update(dt, arenaWidth, arenaHeight);
+
+                grid.clear();
+                for (int p = 0; p < projectiles.size(); ++p) {
+                    grid.insert(projectiles.getBounds(p), CollisionLayer::BOSS_SHOT, p);
+                }
+                grid.build();
+
+                candidates.clear();
+                grid.query(playerBox, CollisionLayer::BOSS_SHOT, candidates);
+                float damage = projectiles.collide(playerBox, candidates);
+                projectiles.removeSpent();
+                keep(damage);
+            }
+        });
+    }
+
+    // Draws into an offscreen software renderer, so no window or GPU is needed
+    void benchRenderer(const BenchOptions& options, std::ostream& results) {
+        if (TTF_Init() == -1) {
+            std::cerr << "SDL_ttf could not initialize, skipping renderer benchmarks: " << TTF_GetError() << std::endl;
+            return;
+        }
+
+        SDL_Surface* target = SDL_CreateRGBSurfaceWithFormat(0, 800, 600, 32, SDL_PIXELFORMAT_ARGB8888);
+        SDL_Renderer* softwareRenderer = target ? SDL_CreateSoftwareRenderer(target) : nullptr;
+        if (!softwareRenderer) {
+            std::cerr << "Software renderer creation failed, skipping renderer benchmarks: " << SDL_GetError() << std::endl;
+            if (target) SDL_FreeSurface(target);
+            TTF_Quit();
+            return;
+        }
+
+        {
+            Renderer renderer(softwareRenderer, 800, 600);
+            SDL_Color white = {255, 255, 255, 255};
+
+            runBench(options, results, "Renderer::drawText/short", [&](long long iterations) {
+                for (long long i = 0; i < iterations; ++i) {
+                    renderer.drawText("Cooldown: 0.50", 10, 10, white);
+                }
+            });
+
+            runBench(options, results, "Renderer::drawText/long", [&](long long iterations) {
+                for (long long i = 0; i < iterations; ++i) {
+                    renderer.drawText("  12.3s: ATTACK (LIGHT_COMBO_1) -> Dist:5.2 Close", 10, 30, white);
+                }
+            });
+
+            runBench(options, results, "Renderer::drawCircle/r5", [&](long long iterations) {
+                for (long long i = 0; i < iterations; ++i) {
+                    renderer.drawCircle(400, 300, 5, white);
+                    renderer.flushBatches();
+                }
+            });
+
+            runBench(options, results, "Renderer::drawCircle/r180", [&](long long iterations) {
+                for (long long i = 0; i < iterations; ++i) {
+                    renderer.drawCircle(400, 300, 180, white);
+                    renderer.flushBatches();
+                }
+            });
+
+            // 64 tinted sprites from one sheet, as a crowd of sprite characters would draw
+            SDL_Texture* sheet = SDL_CreateTexture(softwareRenderer, SDL_PIXELFORMAT_ARGB8888,
+                                                   SDL_TEXTUREACCESS_STATIC, 256, 256);
+            if (sheet) {
+                SDL_SetTextureBlendMode(sheet, SDL_BLENDMODE_BLEND);
+                runBench(options, results, "Renderer::drawSprite/64", [&](long long iterations) {
+                    for (long long i = 0; i < iterations; ++i) {
+                        for (int sprite = 0; sprite < 64; ++sprite) {
+                            SDL_Rect source = {(sprite % 8) * 32, (sprite / 8) * 32, 32, 32};
+                            SDL_Rect dest = {(sprite % 8) * 80, (sprite / 8) * 60, 80, 80};
+                            renderer.drawSprite(sheet, 256, 256, source, dest, {150, 150, 255, 180});
+                        }
+                        renderer.flushBatches();
+                    }
+                });
+                SDL_DestroyTexture(sheet);
+            }
+        }
+
+        SDL_DestroyRenderer(softwareRenderer);
+        SDL_FreeSurface(target);
+        TTF_Quit();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            options.minSeconds = std::max(0.001, std::atof(argv[++i]));
+        } else if (argv[i][0] != '-' && options.filter.empty()) {
+            options.filter = argv[i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--min-time SECONDS] [NAME_FILTER]" << std::endl;
+            return -1;
+        }
+    }
+
+    // Results keep stdout to themselves; game logging goes to stderr
+    std::ostream results(std::cout.rdbuf());
+    std::streambuf* stdoutBuffer = std::cout.rdbuf(std::cerr.rdbuf());
+
+    benchCollision(options, results);
+    benchVector2D(options, results);
+    benchSelectAction(options, results);
+    benchBossAnimation(options, results);
+    benchProjectiles(options, results);
+    benchRenderer(options, results);
+
+    std::cout.rdbuf(stdoutBuffer);
+    return 0;
+}
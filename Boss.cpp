@@ -1,7 +1,9 @@
 #include "Boss.h"
 #include "GameUnits.h"
-#include "Sif.h"
 #include "Vector2D.h"
+#include "Renderer.h"
+#include "AttackTable.h"
+#include "SwordMotion.h"
 #include <algorithm>
 #include <iostream>
 
@@ -11,16 +13,17 @@
 
 float bossAttackRange = 6.0f;
 
-Boss::Boss(float x, float y)
-    : Entity(x, y, 60, 120, 300),
-      m_animState(BossAnimState::IDLE),
+Boss::Boss(EntityStore& store, float x, float y)
+    : Entity(store, x, y, 60, 120, 300),
       m_currentAttackAnim(BossAttackAnim::HORIZONTAL_SWING),
       m_animTimer(0.0f),
       m_animDuration(0.0f),
       m_windupTimer(0.0f),
       m_windupDuration(0.0f),
+      m_elapsedTime(0.0f),
       m_facingDirection(0, 1),
       m_swordAngle(0.0f),
+      m_previousSwordAngle(0.0f),
       m_swordLength(6.0f),
       m_swordOnRightSide(true),
       m_baseAttackDamage(25.0f),
@@ -29,6 +32,11 @@ Boss::Boss(float x, float y)
       m_hasDealtDamage(false),
       m_moveSpeed(8.0f),
     m_currentMoveSpeed(8.0f) {
+    setAnimState(BossAnimState::IDLE);
+
+    // Keep in bounds
+    setMoveBounds(Vector2D(GameUnits::toMeters(60.0f), GameUnits::toMeters(120.0f)),
+                  Vector2D(GameUnits::toMeters(740.0f), GameUnits::toMeters(480.0f)));
     updateSwordPosition();
 }
 
@@ -36,9 +44,10 @@ void Boss::update(float deltaTime) {
     // Update animation
     updateAnimation(deltaTime);
    
-    // Handle movement
-    if (m_animState == BossAnimState::MOVING) {
-        Vector2D toTarget = m_targetMovePosition - m_position;
+    // Handle movement: pick this tick's velocity; EntityStore::integrate moves and clamps
+    velocity() = Vector2D(0, 0);
+    if (animState() == BossAnimState::MOVING) {
+        Vector2D toTarget = m_targetMovePosition - position();
         float distance = toTarget.length();
 
 
@@ -55,60 +64,34 @@ void Boss::update(float deltaTime) {
 
             Vector2D movement = toTarget.normalized() * m_moveSpeed * deltaTime;
 
-            // Prevent overshooting
+            // Prevent overshooting: just reach the target this tick
             if (movement.length() > distance) {
-                m_position = m_targetMovePosition;
-                m_animState = BossAnimState::IDLE;
+                velocity() = toTarget * (1.0f / deltaTime);
+                setAnimState(BossAnimState::IDLE);
             } else {
-                m_position = m_position + movement;
+                velocity() = toTarget.normalized() * m_moveSpeed;
             }
 
             // Update facing direction while moving
             m_facingDirection = toTarget.normalized();
-            
-            // Keep in bounds
-            float minX = GameUnits::toMeters(60.0f);  // 2.67 meters
-            float maxX = GameUnits::toMeters(740.0f); // 24 meters
-            float minY = GameUnits::toMeters(120.0f);  // 2.67 meters
-            float maxY = GameUnits::toMeters(480.0f); // 17.33 meters
-            
-            m_position.x = (std::max(minX, std::min(maxX, m_position.x)));
-            m_position.y = (std::max(minY, std::min(maxY, m_position.y)));
         } else {
             // Reached target
-            m_animState = BossAnimState::IDLE;
+            setAnimState(BossAnimState::IDLE);
         }
     }
-    updateSwordPosition();
 }
 
 void Boss::updateAnimation(float deltaTime) {
+    m_elapsedTime += deltaTime;
+    m_previousSwordAngle = m_swordAngle;
+
     // Handle wind-up phase
     if (m_windupTimer > 0) {
         m_windupTimer -= deltaTime;
         
         // Wind-up animation (pull sword back)
         float windupProgress = 1.0f - (m_windupTimer / m_windupDuration);
-        
-        switch (m_currentAttackAnim) {
-            case BossAttackAnim::HORIZONTAL_SWING:
-                m_swordAngle = m_swordOnRightSide ? -M_PI * 0.3f * windupProgress : M_PI + M_PI * 0.3f * windupProgress;
-                break;
-            case BossAttackAnim::OVERHEAD_SWING:
-            case BossAttackAnim::GROUND_SLAM:
-                m_swordAngle = -M_PI * 0.8f * windupProgress;
-                break;
-            case BossAttackAnim::SPIN_ATTACK:
-                // Slight pullback before spin
-                m_swordAngle = -M_PI * 0.2f * windupProgress;
-                break;
-            case BossAttackAnim::UPPERCUT:
-                m_swordAngle = M_PI * 0.4f * windupProgress;
-                break;
-            default:
-                m_swordAngle = -M_PI * 0.2f * windupProgress;
-                break;
-        }
+        m_swordAngle = SwordMotion::windupAngle(m_currentAttackAnim, m_swordOnRightSide, windupProgress);
         
         return; // Don't process attack animation while winding up
     }
@@ -118,88 +101,47 @@ void Boss::updateAnimation(float deltaTime) {
         m_animTimer -= deltaTime;
         
         // Handle different attack animations
-        if (m_animState == BossAnimState::ATTACKING) {
+        if (animState() == BossAnimState::ATTACKING) {
             float attackProgress = 1.0f - (m_animTimer / m_animDuration);
 
-            switch (m_currentAttackAnim) {
-                case BossAttackAnim::HORIZONTAL_SWING:
-                    if (m_swordOnRightSide) {
-                        m_swordAngle = -M_PI * 0.3f + (M_PI * 1.3f * attackProgress);
-                    } else {
-                        m_swordAngle = M_PI * 1.3f - (M_PI * 1.3f * attackProgress);
-                    }
-                    break;
-                    
-                case BossAttackAnim::SPIN_ATTACK:
-                    m_swordAngle += (2 * M_PI * deltaTime / m_animDuration) * 2;
-                    break;
-                    
-                case BossAttackAnim::OVERHEAD_SWING:
-                    m_swordAngle = -M_PI * 0.8f + (M_PI * 1.3f * attackProgress);
-                    break;                    
-
-                case BossAttackAnim::UPPERCUT:
-                    m_swordAngle = M_PI * 0.4f - (M_PI * 0.9f * attackProgress);
-                    break;
-                    
-                case BossAttackAnim::GROUND_SLAM:
-                    if (attackProgress < 0.3f) {
-                        // Stay raised
-                        m_swordAngle = -M_PI * 0.8f;
-                    } else {
-                        // Slam down
-                        float slamProgress = (attackProgress - 0.3f) / 0.7f;
-                        m_swordAngle = -M_PI * 0.8f + (M_PI * 1.3f * slamProgress);
-                    }
-                    break;
-                    
-                case BossAttackAnim::DASH_ATTACK:
-                    m_swordAngle = m_swordOnRightSide ? -M_PI * 0.2f : M_PI * 1.2f;
-                    break;
-                    
-                case BossAttackAnim::BACKSTEP_SLASH:
-                    m_swordAngle = m_swordOnRightSide ? M_PI * 0.3f : M_PI * 0.7f;
-                    break;
-                    
-                case BossAttackAnim::PROJECTILE:
-                    m_swordAngle = -M_PI * 0.4f + sin(m_animTimer * 10) * 0.1f;
-                    break;
-            }
+            m_swordAngle = SwordMotion::swingAngle(m_currentAttackAnim, m_swordOnRightSide, attackProgress);
         }
         
         // Transition to recovery or idle
         if (m_animTimer <= 0) {
-            if (m_animState == BossAnimState::ATTACKING) {
-                m_animState = BossAnimState::RECOVERING;
+            if (animState() == BossAnimState::ATTACKING) {
+                setAnimState(BossAnimState::RECOVERING);
                 m_animTimer = 0.3f;
                 m_animDuration = 0.3f;
                 
                 // Some attacks switch sword side
-                if (m_currentAttackAnim == BossAttackAnim::HORIZONTAL_SWING) {
+                if (AttackTable::anim(m_currentAttackAnim).swapsSide) {
                     m_swordOnRightSide = !m_swordOnRightSide;
                 }
-            } else if (m_animState == BossAnimState::RECOVERING) {
-                m_animState = BossAnimState::IDLE;
+            } else if (animState() == BossAnimState::RECOVERING) {
+                setAnimState(BossAnimState::IDLE);
                 m_swordAngle = m_swordOnRightSide ? 0.0f : M_PI;
-            } else if (m_animState == BossAnimState::DAMAGED) {
-                m_animState = BossAnimState::IDLE;
+            } else if (animState() == BossAnimState::DAMAGED) {
+                setAnimState(BossAnimState::IDLE);
             }
         }
     }
     
     // Idle animation
-    if (m_animState == BossAnimState::IDLE) {
+    if (animState() == BossAnimState::IDLE) {
         m_swordAngle = m_swordOnRightSide ? 0.0f : M_PI;
-        m_swordAngle += sin(SDL_GetTicks() * 0.001f * 1.5f) * 0.05f;
+        m_swordAngle += SwordMotion::direction(m_elapsedTime * 1.5f).y * 0.05f;
     }
 }
 
-void Boss::render(SDL_Renderer* renderer) {
+void Boss::render(Renderer& renderer) {
+    PrimitiveBatch& batch = renderer.primitives();
+
     // Draw wolf body
     SDL_Color bodyColor;
-    bool isInjured = m_currentHealth < m_maxHealth * 0.3f;
+    bool isInjured = health() < getMaxHealth() * 0.3f;
     
-    switch (m_animState) {
+    switch (animState()) {
         case BossAnimState::ATTACKING:
             bodyColor = isInjured ? SDL_Color{80, 80, 80, 255} : SDL_Color{100, 100, 100, 255};
             break;
@@ -223,18 +165,18 @@ void Boss::render(SDL_Renderer* renderer) {
         bodyColor.b = std::min(255, (int)(bodyColor.b + flashIntensity * 50));
     }
 
-    SDL_SetRenderDrawColor(renderer, bodyColor.r, bodyColor.g, bodyColor.b, bodyColor.a);
+    batch.setColor(bodyColor);
     SDL_Rect rect = getCollisionBox();
-    SDL_RenderFillRect(renderer, &rect);
+    batch.fillRect(rect);
     
     // Draw injuries when health is low
     if (isInjured) {
-        SDL_SetRenderDrawColor(renderer, 150, 50, 50, 255);
+        batch.setColor(150, 50, 50);
         SDL_Rect injuryRect = {rect.x + 10, rect.y + 20, 10, 5};
-        SDL_RenderFillRect(renderer, &injuryRect);
+        batch.fillRect(injuryRect);
         injuryRect.x += 20;
         injuryRect.y -= 10;
-        SDL_RenderFillRect(renderer, &injuryRect);
+        batch.fillRect(injuryRect);
     }
     
     // Draw sword
@@ -248,50 +190,43 @@ void Boss::render(SDL_Renderer* renderer) {
         swordColor.b = std::min(255, (int)(200 + glowIntensity * 30));
     }
 
-    SDL_SetRenderDrawColor(renderer, swordColor.r, swordColor.g, swordColor.b, swordColor.a);
+    batch.setColor(swordColor);
     
-    Vector2D m_swordBase = m_position + m_facingDirection * GameUnits::toMeters(30);
-    Vector2D swordEnd = m_swordBase + Vector2D(cos(m_swordAngle), sin(m_swordAngle)) * m_swordLength;
+    Vector2D m_swordBase = position() + m_facingDirection * GameUnits::toMeters(30);
+    Vector2D swordEnd = m_swordBase + SwordMotion::direction(m_swordAngle) * m_swordLength;
     
     Vector2D pixelBase = GameUnits::toPixels(m_swordBase);
     Vector2D pixelEnd = GameUnits::toPixels(swordEnd);
 
-    // Draw sword as thick line
-    for (int i = -2; i <= 2; i++) {
-        SDL_RenderDrawLine(renderer, 
-            pixelBase.x + i, pixelBase.y,
-            pixelEnd.x + i, pixelEnd.y);
-        SDL_RenderDrawLine(renderer, 
-            pixelBase.x, pixelBase.y + i,
-            pixelEnd.x, pixelEnd.y + i);
-    }
+    // Draw sword as a 5 px wide quad
+    batch.thickLine(pixelBase.x, pixelBase.y, pixelEnd.x, pixelEnd.y, 5.0f);
     
     // Draw sword hilt
-    SDL_SetRenderDrawColor(renderer, 150, 100, 50, 255);
+    batch.setColor(150, 100, 50);
     SDL_Rect hiltRect = {
         (int)pixelBase.x - 5,
         (int)pixelBase.y - 5,
         10, 10
     };
-    SDL_RenderFillRect(renderer, &hiltRect);
+    batch.fillRect(hiltRect);
     
     // Draw eyes
-    Vector2D pixelPos = GameUnits::toPixels(m_position);
-    SDL_SetRenderDrawColor(renderer, isInjured ? 100 : 255, 50, 50, 255);
+    Vector2D pixelPos = GameUnits::toPixels(position());
+    batch.setColor(isInjured ? 100 : 255, 50, 50);
 
     // Make eyes glow during wind-up
     if (m_windupTimer > 0) {
-        SDL_SetRenderDrawColor(renderer, 255, 200, 50, 255);
+        batch.setColor(255, 200, 50);
     }
 
     Vector2D eyeOffset(-10, -10);
     Vector2D eyePos = pixelPos + eyeOffset;
     SDL_Rect eyeRect = {(int)eyePos.x - 2, (int)eyePos.y - 2, 4, 4};
-    SDL_RenderFillRect(renderer, &eyeRect);
+    batch.fillRect(eyeRect);
     eyeOffset.x = 10;
     eyePos = pixelPos + eyeOffset;
     eyeRect = {(int)eyePos.x - 2, (int)eyePos.y - 2, 4, 4};
-    SDL_RenderFillRect(renderer, &eyeRect);
+    batch.fillRect(eyeRect);
 }
 
 void Boss::setFacingDirection(const Vector2D& direction) {
@@ -302,53 +237,15 @@ void Boss::setFacingDirection(const Vector2D& direction) {
 void Boss::startAttackAnimation(BossAttackAnim attackType) {
     if (!canAct()) return;
     
-    m_animState = BossAnimState::ATTACKING;
+    setAnimState(BossAnimState::ATTACKING);
     m_currentAttackAnim = attackType;
     m_hasDealtDamage = false;
     
     // Set wind-up, animation durations and damage
-    switch (attackType) {
-        case BossAttackAnim::HORIZONTAL_SWING:
-            m_windupDuration = 0.7f;
-            m_animDuration = 0.4f;
-            m_currentAttackDamage = m_baseAttackDamage;
-            break;
-        case BossAttackAnim::SPIN_ATTACK:
-            m_windupDuration = 0.8f;
-            m_animDuration = 0.8f;
-            m_currentAttackDamage = m_baseAttackDamage * 1.2f;
-            break;
-        case BossAttackAnim::OVERHEAD_SWING:
-            m_windupDuration = 0.9f;
-            m_animDuration = 0.5f;
-            m_currentAttackDamage = m_baseAttackDamage * 1.5f;
-            break;
-        case BossAttackAnim::UPPERCUT:
-            m_windupDuration = 0.7f;
-            m_animDuration = 0.4f;
-            m_currentAttackDamage = m_baseAttackDamage * 1.3f;
-            break;
-        case BossAttackAnim::GROUND_SLAM:
-            m_windupDuration = 1.0f;
-            m_animDuration = 0.6f;
-            m_currentAttackDamage = m_baseAttackDamage * 1.8f;
-            break;
-        case BossAttackAnim::DASH_ATTACK:
-            m_windupDuration = 0.6f;  // Quick wind-up for dash
-            m_animDuration = 0.4f;
-            m_currentAttackDamage = m_baseAttackDamage;
-            break;
-        case BossAttackAnim::BACKSTEP_SLASH:
-            m_windupDuration = 0.6f;
-            m_animDuration = 0.4f;
-            m_currentAttackDamage = m_baseAttackDamage * 1.1f;
-            break;
-        case BossAttackAnim::PROJECTILE:
-            m_windupDuration = 1.0f;  // Long wind-up for projectile
-            m_animDuration = 0.5f;
-            m_currentAttackDamage = m_baseAttackDamage * 0.8f;
-            break;
-    }
+    const AttackTable::AnimDef& def = AttackTable::anim(attackType);
+    m_windupDuration = def.windup;
+    m_animDuration = def.duration;
+    m_currentAttackDamage = m_baseAttackDamage * def.damageMultiplier;
     
     m_windupTimer = m_windupDuration;
     m_animTimer = m_animDuration;
@@ -357,25 +254,22 @@ void Boss::startAttackAnimation(BossAttackAnim attackType) {
 void Boss::startMoving(const Vector2D& targetPos, float speedMultiplier) {
     if (!canAct()) return;
     
-    m_animState = BossAnimState::MOVING;
+    setAnimState(BossAnimState::MOVING);
     m_targetMovePosition = targetPos;
     m_currentMoveSpeed = m_moveSpeed * speedMultiplier;
-    m_facingDirection = (targetPos - m_position).normalized();
+    m_facingDirection = (targetPos - position()).normalized();
 }
 
 void Boss::stopMoving() {
-    if (m_animState == BossAnimState::MOVING) {
-        m_animState = BossAnimState::IDLE;
+    if (animState() == BossAnimState::MOVING) {
+        setAnimState(BossAnimState::IDLE);
     }
 }
 
 void Boss::performStep(const Vector2D& direction, float distance) {
     if (!canAct()) return;
     
-    if (g_sifAI->isDebugEnabled()) {
-        std::cout << "Step Distance: " << distance << std::endl;
-    }
-    Vector2D stepTarget = m_position + direction.normalized() * distance;
+    Vector2D stepTarget = position() + direction.normalized() * distance;
     
     // Keep in bounds
     float minX = GameUnits::toMeters(60.0f);  // 2.67 meters
@@ -391,9 +285,9 @@ void Boss::performStep(const Vector2D& direction, float distance) {
 
 // Cancel an ongoing attack (add to Boss.cpp)
 void Boss::cancelAttack() {
-    if (m_animState == BossAnimState::ATTACKING || 
-        m_animState == BossAnimState::RECOVERING) {
-        m_animState = BossAnimState::IDLE;
+    if (animState() == BossAnimState::ATTACKING || 
+        animState() == BossAnimState::RECOVERING) {
+        setAnimState(BossAnimState::IDLE);
         m_animTimer = 0;
         m_animDuration = 0;
         m_windupTimer = 0;
@@ -407,7 +301,7 @@ void Boss::cancelAttack() {
 
 // Force return to idle state
 void Boss::forceIdle() {
-    m_animState = BossAnimState::IDLE;
+    setAnimState(BossAnimState::IDLE);
     m_animTimer = 0;
     m_animDuration = 0;
     m_windupTimer = 0;
@@ -419,16 +313,16 @@ void Boss::forceIdle() {
 void Boss::takeDamage(float damage) {
     Entity::takeDamage(damage);
     
-    if (m_animState != BossAnimState::ATTACKING) {
-        m_animState = BossAnimState::DAMAGED;
+    if (animState() != BossAnimState::ATTACKING) {
+        setAnimState(BossAnimState::DAMAGED);
         m_animTimer = 0.2f;
         m_animDuration = 0.2f;
     }
 }
 
 void Boss::updateSwordPosition() {
-    m_swordBase = m_position + m_facingDirection * GameUnits::toMeters(30);
-    m_swordTipPosition = m_swordBase + Vector2D(cos(m_swordAngle), sin(m_swordAngle)) * m_swordLength;
+    m_swordBase = position() + m_facingDirection * GameUnits::toMeters(30);
+    m_swordTipPosition = m_swordBase + SwordMotion::direction(m_swordAngle) * m_swordLength;
 }
 
 float Boss::getAnimationProgress() const {
@@ -444,18 +338,19 @@ float Boss::getAnimationProgress() const {
 }
 
 bool Boss::isAttacking() const {
-    return m_animState == BossAnimState::ATTACKING && m_windupTimer <= 0;
+    return animState() == BossAnimState::ATTACKING && m_windupTimer <= 0;
 }
 
 bool Boss::isWindingUp() const {
-    return m_animState == BossAnimState::ATTACKING && m_windupTimer > 0;
+    return animState() == BossAnimState::ATTACKING && m_windupTimer > 0;
 }
 
 Circle Boss::getAttackCircle() const {
-    if (m_currentAttackAnim == BossAttackAnim::SPIN_ATTACK) {
-        return Circle(m_position.x, m_position.y, m_swordLength + 40);
+    const AttackTable::AnimDef& def = AttackTable::anim(m_currentAttackAnim);
+    if (def.hitShape == AttackTable::HitShape::BODY_CIRCLE) {
+        return Circle(position().x, position().y, m_swordLength + def.hitRadius);
     }
-    return Circle(m_swordTipPosition.x, m_swordTipPosition.y, 30);
+    return Circle(m_swordTipPosition.x, m_swordTipPosition.y, def.hitRadius);
 }
 
 SDL_Rect Boss::getSwordHitbox() const {
@@ -468,3 +363,10 @@ SDL_Rect Boss::getSwordHitbox() const {
     int h = std::abs(pixelSwordTip.y - pixelPos.y) + 20;
     return SDL_Rect{x, y, w, h};
 }
+
+SwordArc Boss::getSwordArc() const {
+    // Shortest way round; even a spin turns well under half a revolution per tick
+    float sweep = std::remainder(m_swordAngle - m_previousSwordAngle, 2.0f * (float)M_PI);
+    Vector2D pixelBase = GameUnits::toPixels(m_swordBase);
+    return SwordArc{pixelBase.x, pixelBase.y, GameUnits::toPixels(m_swordLength), m_swordAngle - sweep, sweep, 10.0f};
+}
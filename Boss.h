@@ -27,22 +27,24 @@ enum class BossAttackAnim {
     GROUND_SLAM,
     DASH_ATTACK,
     PROJECTILE,
-    BACKSTEP_SLASH
+    BACKSTEP_SLASH,
+    COUNT  // Keep last; sizes AttackTable::ANIMS
 };
 
-class Boss : public Entity {
+class Boss final : public Entity {
 private:
     // Animation state
-    BossAnimState m_animState;
     BossAttackAnim m_currentAttackAnim;
     float m_animTimer;
     float m_animDuration;
     float m_windupTimer;
     float m_windupDuration;
+    float m_elapsedTime;  // Simulation time, drives idle sway
     
     // Visual properties
     Vector2D m_facingDirection;
     float m_swordAngle;
+    float m_previousSwordAngle;  // Where the blade was at the start of the last animation step
     float m_swordLength;
     Vector2D m_swordBase;
     Vector2D m_swordTipPosition;
@@ -61,13 +63,16 @@ private:
     
     // Helper methods
     void updateSwordPosition();
-    void updateAnimation(float deltaTime);
+    BossAnimState animState() const { return static_cast<BossAnimState>(getAnimStateValue()); }
+    void setAnimState(BossAnimState state) { setAnimStateValue(static_cast<int>(state)); }
     
 public:
-    Boss(float x, float y);
+    Boss(EntityStore& store, float x, float y);
     
     void update(float deltaTime) override;
-    void render(SDL_Renderer* renderer) override;
+    void onMoved() override { updateSwordPosition(); }
+    void updateAnimation(float deltaTime);  // Sword pose and state timers only; update() also steers
+    void render(Renderer& renderer) override;
     
     // AI Interface - These are called by Sif AI
     void setFacingDirection(const Vector2D& direction);
@@ -80,24 +85,26 @@ public:
 
     // State queries for AI
     bool isAttacking() const;
-    bool isRecovering() const { return m_animState == BossAnimState::RECOVERING; }
-    bool isMoving() const { return m_animState == BossAnimState::MOVING; };
-    bool canAct() const { return m_animState == BossAnimState::IDLE || m_animState == BossAnimState::MOVING; }
+    bool isRecovering() const { return animState() == BossAnimState::RECOVERING; }
+    bool isMoving() const { return animState() == BossAnimState::MOVING; };
+    bool canAct() const { return animState() == BossAnimState::IDLE || animState() == BossAnimState::MOVING; }
     bool isWindingUp() const;
     float getAttackRange() const { return m_attackRange; }
     float getAttackDamage() const { return m_currentAttackDamage; }
     float getAnimationProgress() const;
     Vector2D getSwordBase() const { return m_swordBase; }
+    Vector2D getSwordTip() const { return m_swordTipPosition; }
 
     // Combat
     Circle getAttackCircle() const;
     SDL_Rect getSwordHitbox() const;
+    SwordArc getSwordArc() const;  // The blade's turn during the last animation step
     bool hasDealtDamage() const { return m_hasDealtDamage; }
     void setDamageDealt() { m_hasDealtDamage = true; }
     void takeDamage(float damage) override;
 
     // Getter methods for rendering
-    BossAnimState getAnimState() const { return m_animState; }
+    BossAnimState getAnimState() const { return animState(); }
     BossAttackAnim getCurrentAttackAnim() const { return m_currentAttackAnim; }
 };
 
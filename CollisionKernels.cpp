@@ -0,0 +1,286 @@
+#include "CollisionKernels.h"
+#include <algorithm>
+#include <cstring>
+
+// SSE2 is the x86-64 baseline and is always compiled. AVX2 is compiled alongside
+// it through a target attribute and only run when the CPU reports it.
+#if defined(COLLISION_KERNELS_SCALAR)
+// Plain loops only
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define KERNELS_SSE2 1
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define KERNELS_AVX2 1
+#define AVX2_TARGET __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace {
+    // Lanes per block divide 32, so a block's bits never straddle two mask words
+    inline void setBits(Uint32* hits, int first, Uint32 bits) {
+        hits[first >> 5] |= bits << (first & 31);
+    }
+
+    bool boxHitsBox(const SDL_Rect& a, int x, int y, int w, int h) {
+        return a.x < x + w && a.x + a.w > x && a.y < y + h && a.y + a.h > y;
+    }
+
+    bool circleHitsBox(float cx, float cy, float radiusSquared, float x, float y, float x2, float y2) {
+        float dx = cx - std::min(std::max(cx, x), x2);
+        float dy = cy - std::min(std::max(cy, y), y2);
+        return dx * dx + dy * dy < radiusSquared;
+    }
+
+    bool boxHitsCircle(float left, float top, float right, float bottom, float radiusSquared, float x, float y) {
+        float dx = x - std::min(std::max(x, left), right);
+        float dy = y - std::min(std::max(y, top), bottom);
+        return dx * dx + dy * dy < radiusSquared;
+    }
+
+    // Scalar loops from candidate first on: the whole batch for the scalar
+    // backend, the tail after the last full block for the SIMD ones
+    void boxVsBoxesFrom(int first, const SDL_Rect& box, const int* xs, const int* ys, const int* ws, const int* hs,
+                        int count, Uint32* hits) {
+        for (int i = first; i < count; ++i) {
+            if (boxHitsBox(box, xs[i], ys[i], ws[i], hs[i])) {
+                setBits(hits, i, 1u);
+            }
+        }
+    }
+
+    void circleVsBoxesFrom(int first, float cx, float cy, float radiusSquared, const int* xs, const int* ys,
+                           const int* ws, const int* hs, int count, Uint32* hits) {
+        for (int i = first; i < count; ++i) {
+            if (circleHitsBox(cx, cy, radiusSquared, (float)xs[i], (float)ys[i], (float)(xs[i] + ws[i]),
+                              (float)(ys[i] + hs[i]))) {
+                setBits(hits, i, 1u);
+            }
+        }
+    }
+
+    void boxVsCirclesFrom(int first, float left, float top, float right, float bottom, float radiusSquared,
+                          const float* xs, const float* ys, int count, Uint32* hits) {
+        for (int i = first; i < count; ++i) {
+            if (boxHitsCircle(left, top, right, bottom, radiusSquared, xs[i], ys[i])) {
+                setBits(hits, i, 1u);
+            }
+        }
+    }
+
+    void boxVsBoxesScalar(const SDL_Rect& box, const int* xs, const int* ys, const int* ws, const int* hs,
+                          int count, Uint32* hits) {
+        boxVsBoxesFrom(0, box, xs, ys, ws, hs, count, hits);
+    }
+
+    void circleVsBoxesScalar(float cx, float cy, float radiusSquared, const int* xs, const int* ys, const int* ws,
+                             const int* hs, int count, Uint32* hits) {
+        circleVsBoxesFrom(0, cx, cy, radiusSquared, xs, ys, ws, hs, count, hits);
+    }
+
+    void boxVsCirclesScalar(float left, float top, float right, float bottom, float radiusSquared,
+                            const float* xs, const float* ys, int count, Uint32* hits) {
+        boxVsCirclesFrom(0, left, top, right, bottom, radiusSquared, xs, ys, count, hits);
+    }
+
+#if defined(KERNELS_SSE2)
+    void boxVsBoxesSse2(const SDL_Rect& box, const int* xs, const int* ys, const int* ws, const int* hs,
+                        int count, Uint32* hits) {
+        const __m128i left = _mm_set1_epi32(box.x);
+        const __m128i right = _mm_set1_epi32(box.x + box.w);
+        const __m128i top = _mm_set1_epi32(box.y);
+        const __m128i bottom = _mm_set1_epi32(box.y + box.h);
+        int i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(xs + i));
+            __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ys + i));
+            __m128i x2 = _mm_add_epi32(x, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ws + i)));
+            __m128i y2 = _mm_add_epi32(y, _mm_loadu_si128(reinterpret_cast<const __m128i*>(hs + i)));
+            __m128i hit = _mm_and_si128(_mm_cmpgt_epi32(x2, left), _mm_cmplt_epi32(x, right));
+            hit = _mm_and_si128(hit, _mm_and_si128(_mm_cmpgt_epi32(y2, top), _mm_cmplt_epi32(y, bottom)));
+            setBits(hits, i, (Uint32)_mm_movemask_ps(_mm_castsi128_ps(hit)));
+        }
+        boxVsBoxesFrom(i, box, xs, ys, ws, hs, count, hits);
+    }
+
+    void circleVsBoxesSse2(float cx, float cy, float radiusSquared, const int* xs, const int* ys, const int* ws,
+                           const int* hs, int count, Uint32* hits) {
+        const __m128 centreX = _mm_set1_ps(cx);
+        const __m128 centreY = _mm_set1_ps(cy);
+        const __m128 r2 = _mm_set1_ps(radiusSquared);
+        int i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128i xi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(xs + i));
+            __m128i yi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ys + i));
+            __m128 x = _mm_cvtepi32_ps(xi);
+            __m128 y = _mm_cvtepi32_ps(yi);
+            __m128 x2 = _mm_cvtepi32_ps(_mm_add_epi32(xi, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ws + i))));
+            __m128 y2 = _mm_cvtepi32_ps(_mm_add_epi32(yi, _mm_loadu_si128(reinterpret_cast<const __m128i*>(hs + i))));
+            __m128 dx = _mm_sub_ps(centreX, _mm_min_ps(_mm_max_ps(centreX, x), x2));
+            __m128 dy = _mm_sub_ps(centreY, _mm_min_ps(_mm_max_ps(centreY, y), y2));
+            __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            setBits(hits, i, (Uint32)_mm_movemask_ps(_mm_cmplt_ps(d2, r2)));
+        }
+        circleVsBoxesFrom(i, cx, cy, radiusSquared, xs, ys, ws, hs, count, hits);
+    }
+
+    void boxVsCirclesSse2(float left, float top, float right, float bottom, float radiusSquared,
+                          const float* xs, const float* ys, int count, Uint32* hits) {
+        const __m128 l = _mm_set1_ps(left);
+        const __m128 t = _mm_set1_ps(top);
+        const __m128 r = _mm_set1_ps(right);
+        const __m128 b = _mm_set1_ps(bottom);
+        const __m128 r2 = _mm_set1_ps(radiusSquared);
+        int i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128 x = _mm_loadu_ps(xs + i);
+            __m128 y = _mm_loadu_ps(ys + i);
+            __m128 dx = _mm_sub_ps(x, _mm_min_ps(_mm_max_ps(x, l), r));
+            __m128 dy = _mm_sub_ps(y, _mm_min_ps(_mm_max_ps(y, t), b));
+            __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            setBits(hits, i, (Uint32)_mm_movemask_ps(_mm_cmplt_ps(d2, r2)));
+        }
+        boxVsCirclesFrom(i, left, top, right, bottom, radiusSquared, xs, ys, count, hits);
+    }
+#endif
+
+#if defined(KERNELS_AVX2)
+    AVX2_TARGET void boxVsBoxesAvx2(const SDL_Rect& box, const int* xs, const int* ys, const int* ws, const int* hs,
+                                    int count, Uint32* hits) {
+        const __m256i left = _mm256_set1_epi32(box.x);
+        const __m256i right = _mm256_set1_epi32(box.x + box.w);
+        const __m256i top = _mm256_set1_epi32(box.y);
+        const __m256i bottom = _mm256_set1_epi32(box.y + box.h);
+        int i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xs + i));
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ys + i));
+            __m256i x2 = _mm256_add_epi32(x, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ws + i)));
+            __m256i y2 = _mm256_add_epi32(y, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hs + i)));
+            __m256i hit = _mm256_and_si256(_mm256_cmpgt_epi32(x2, left), _mm256_cmpgt_epi32(right, x));
+            hit = _mm256_and_si256(hit, _mm256_and_si256(_mm256_cmpgt_epi32(y2, top), _mm256_cmpgt_epi32(bottom, y)));
+            setBits(hits, i, (Uint32)_mm256_movemask_ps(_mm256_castsi256_ps(hit)));
+        }
+        boxVsBoxesFrom(i, box, xs, ys, ws, hs, count, hits);
+    }
+
+    AVX2_TARGET void circleVsBoxesAvx2(float cx, float cy, float radiusSquared, const int* xs, const int* ys,
+                                       const int* ws, const int* hs, int count, Uint32* hits) {
+        const __m256 centreX = _mm256_set1_ps(cx);
+        const __m256 centreY = _mm256_set1_ps(cy);
+        const __m256 r2 = _mm256_set1_ps(radiusSquared);
+        int i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256i xi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xs + i));
+            __m256i yi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ys + i));
+            __m256 x = _mm256_cvtepi32_ps(xi);
+            __m256 y = _mm256_cvtepi32_ps(yi);
+            __m256 x2 = _mm256_cvtepi32_ps(_mm256_add_epi32(xi, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ws + i))));
+            __m256 y2 = _mm256_cvtepi32_ps(_mm256_add_epi32(yi, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hs + i))));
+            __m256 dx = _mm256_sub_ps(centreX, _mm256_min_ps(_mm256_max_ps(centreX, x), x2));
+            __m256 dy = _mm256_sub_ps(centreY, _mm256_min_ps(_mm256_max_ps(centreY, y), y2));
+            __m256 d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            setBits(hits, i, (Uint32)_mm256_movemask_ps(_mm256_cmp_ps(d2, r2, _CMP_LT_OQ)));
+        }
+        circleVsBoxesFrom(i, cx, cy, radiusSquared, xs, ys, ws, hs, count, hits);
+    }
+
+    AVX2_TARGET void boxVsCirclesAvx2(float left, float top, float right, float bottom, float radiusSquared,
+                                      const float* xs, const float* ys, int count, Uint32* hits) {
+        const __m256 l = _mm256_set1_ps(left);
+        const __m256 t = _mm256_set1_ps(top);
+        const __m256 r = _mm256_set1_ps(right);
+        const __m256 b = _mm256_set1_ps(bottom);
+        const __m256 r2 = _mm256_set1_ps(radiusSquared);
+        int i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256 x = _mm256_loadu_ps(xs + i);
+            __m256 y = _mm256_loadu_ps(ys + i);
+            __m256 dx = _mm256_sub_ps(x, _mm256_min_ps(_mm256_max_ps(x, l), r));
+            __m256 dy = _mm256_sub_ps(y, _mm256_min_ps(_mm256_max_ps(y, t), b));
+            __m256 d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            setBits(hits, i, (Uint32)_mm256_movemask_ps(_mm256_cmp_ps(d2, r2, _CMP_LT_OQ)));
+        }
+        boxVsCirclesFrom(i, left, top, right, bottom, radiusSquared, xs, ys, count, hits);
+    }
+#endif
+
+    struct Backend {
+        const char* name;
+        void (*boxVsBoxes)(const SDL_Rect&, const int*, const int*, const int*, const int*, int, Uint32*);
+        void (*circleVsBoxes)(float, float, float, const int*, const int*, const int*, const int*, int, Uint32*);
+        void (*boxVsCircles)(float, float, float, float, float, const float*, const float*, int, Uint32*);
+    };
+
+    // Fastest first, so detection takes the first one the CPU supports
+    const Backend BACKENDS[] = {
+#if defined(KERNELS_AVX2)
+        {"avx2", boxVsBoxesAvx2, circleVsBoxesAvx2, boxVsCirclesAvx2},
+#endif
+#if defined(KERNELS_SSE2)
+        {"sse2", boxVsBoxesSse2, circleVsBoxesSse2, boxVsCirclesSse2},
+#endif
+        {"scalar", boxVsBoxesScalar, circleVsBoxesScalar, boxVsCirclesScalar},
+    };
+
+    bool isSupported(const Backend& backend) {
+#if defined(KERNELS_AVX2)
+        if (std::strcmp(backend.name, "avx2") == 0) {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+        }
+#endif
+        (void)backend;
+        return true;
+    }
+
+    const Backend* detectBackend() {
+        for (const Backend& backend : BACKENDS) {
+            if (isSupported(backend)) return &backend;
+        }
+        return nullptr;  // Unreachable: scalar is always supported
+    }
+
+    const Backend* s_forcedBackend = nullptr;
+
+    const Backend& activeBackend() {
+        static const Backend* const detected = detectBackend();  // Once, thread-safely
+        return s_forcedBackend ? *s_forcedBackend : *detected;
+    }
+}
+
+const char* CollisionKernels::getBackend() {
+    return activeBackend().name;
+}
+
+bool CollisionKernels::setBackend(const char* name) {
+    if (!name) {
+        s_forcedBackend = nullptr;
+        return true;
+    }
+    for (const Backend& backend : BACKENDS) {
+        if (std::strcmp(backend.name, name) == 0 && isSupported(backend)) {
+            s_forcedBackend = &backend;
+            return true;
+        }
+    }
+    return false;
+}
+
+void CollisionKernels::boxVsBoxes(const SDL_Rect& box, const int* xs, const int* ys, const int* ws, const int* hs,
+                                  int count, Uint32* hits) {
+    std::memset(hits, 0, getMaskWords(count) * sizeof(Uint32));
+    activeBackend().boxVsBoxes(box, xs, ys, ws, hs, count, hits);
+}
+
+void CollisionKernels::circleVsBoxes(float cx, float cy, float radius, const int* xs, const int* ys, const int* ws,
+                                     const int* hs, int count, Uint32* hits) {
+    std::memset(hits, 0, getMaskWords(count) * sizeof(Uint32));
+    activeBackend().circleVsBoxes(cx, cy, radius * radius, xs, ys, ws, hs, count, hits);
+}
+
+void CollisionKernels::boxVsCircles(float left, float top, float right, float bottom, float radius,
+                                    const float* xs, const float* ys, int count, Uint32* hits) {
+    std::memset(hits, 0, getMaskWords(count) * sizeof(Uint32));
+    activeBackend().boxVsCircles(left, top, right, bottom, radius * radius, xs, ys, count, hits);
+}
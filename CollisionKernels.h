@@ -0,0 +1,39 @@
+#ifndef COLLISION_KERNELS_H
+#define COLLISION_KERNELS_H
+
+#include <SDL2/SDL.h>
+
+// Batched narrow phase: one query shape against packed arrays of candidates.
+// Results are bitmasks, bit (i % 32) of hits[i / 32] set when candidate i hits;
+// hits must hold getMaskWords(count) words. Edge rules match checkCollision in
+// Game.cpp, and `make test` checks every result against it (CollisionTest.cpp).
+//
+// The backend is picked once at runtime: AVX2 (8 candidates per instruction)
+// when the CPU supports it, otherwise SSE2 (4), the x86-64 baseline. Other
+// targets, and builds with -DCOLLISION_KERNELS_SCALAR, get plain loops.
+// Only boxVsCircles is used by the game (ProjectilePool::collide); boxVsBoxes
+// and circleVsBoxes are bench-only for now.
+namespace CollisionKernels {
+    inline int getMaskWords(int count) { return (count + 31) / 32; }
+    inline bool isHit(const Uint32* hits, int index) { return (hits[index >> 5] >> (index & 31)) & 1u; }
+
+    const char* getBackend();  // "avx2", "sse2" or "scalar"
+    // Forces a backend by name, or restores detection given null; false if this
+    // build or CPU lacks it. For checking backends against each other: not safe
+    // while another thread is running a kernel.
+    bool setBackend(const char* name);
+
+    // Box against boxes given as x, y, w, h arrays (pixels); touching edges do not hit
+    void boxVsBoxes(const SDL_Rect& box, const int* xs, const int* ys, const int* ws, const int* hs,
+                    int count, Uint32* hits);
+
+    // Circle against boxes; hits when the closest point of the box is strictly inside the circle
+    void circleVsBoxes(float cx, float cy, float radius, const int* xs, const int* ys, const int* ws, const int* hs,
+                       int count, Uint32* hits);
+
+    // Box (left, top, right, bottom) against circles of one radius centred at xs, ys
+    void boxVsCircles(float left, float top, float right, float bottom, float radius,
+                      const float* xs, const float* ys, int count, Uint32* hits);
+}
+
+#endif
@@ -0,0 +1,148 @@
+// Correctness checks for the collision code. Build and run with `make test`;
+// the run exits 1, and so fails the make, if any check disagrees.
+
+#include "Game.h"
+#include "CollisionKernels.h"
+#include "Entity.h"
+#include "SpatialHash.h"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace {
+    // Small LCG so every run sees the same cases
+    int randomInt(unsigned int& seed, int low, int high) {
+        seed = seed * 1664525u + 1013904223u;
+        return low + (int)((seed >> 8) % (unsigned int)(high - low + 1));
+    }
+
+    // The grid must agree with an O(n^2) scan of checkCollision over random
+    // boxes and masks, some boxes hanging off the arena
+    bool checkSpatialHash() {
+        const Uint32 layers[4] = {CollisionLayer::PLAYER_BODY, CollisionLayer::BOSS_BODY,
+                                  CollisionLayer::PLAYER_SHOT, CollisionLayer::BOSS_SHOT};
+        unsigned int seed = 7;
+        SpatialHash grid;
+        grid.setBounds(800, 600);
+        std::vector<SDL_Rect> boxes;
+        std::vector<Uint32> boxLayers;
+        std::vector<int> found, expected;
+
+        for (int round = 0; round < 50; ++round) {
+            grid.clear();
+            boxes.clear();
+            boxLayers.clear();
+            int count = randomInt(seed, 0, 300);
+            for (int i = 0; i < count; ++i) {
+                boxes.push_back(SDL_Rect{randomInt(seed, -100, 850), randomInt(seed, -100, 650),
+                                         randomInt(seed, 1, 150), randomInt(seed, 1, 150)});
+                boxLayers.push_back(layers[randomInt(seed, 0, 3)]);
+                grid.insert(boxes[i], boxLayers[i], i);
+            }
+            grid.build();
+
+            for (int q = 0; q < 100; ++q) {
+                SDL_Rect bounds{randomInt(seed, -100, 850), randomInt(seed, -100, 650),
+                                randomInt(seed, 1, 300), randomInt(seed, 1, 300)};
+                Uint32 mask = (Uint32)randomInt(seed, 1, 15);
+
+                expected.clear();
+                for (int i = 0; i < count; ++i) {
+                    if ((boxLayers[i] & mask) && checkCollision(boxes[i], bounds)) {
+                        expected.push_back(i);
+                    }
+                }
+                found.clear();
+                grid.query(bounds, mask, found);
+                std::sort(found.begin(), found.end());
+
+                if (found != expected || grid.overlapsAny(bounds, mask) != !expected.empty()) {
+                    std::cerr << "SpatialHash disagrees with a brute-force scan (round " << round
+                              << ", query " << q << ")" << std::endl;
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // The active CollisionKernels backend must agree with
+    // checkCollision on random batches, with counts that leave SIMD tails. Inputs are
+    // whole numbers, so every backend's arithmetic is exact and no rounding can differ.
+    bool checkCollisionKernels() {
+        unsigned int seed = 11;
+        const int maxCount = 300;
+        std::vector<int> xs(maxCount), ys(maxCount), ws(maxCount), hs(maxCount);
+        std::vector<float> cxs(maxCount), cys(maxCount);
+        std::vector<Uint32> hitMask(CollisionKernels::getMaskWords(maxCount));
+
+        for (int round = 0; round < 500; ++round) {
+            int count = randomInt(seed, 0, maxCount);
+            for (int i = 0; i < count; ++i) {
+                xs[i] = randomInt(seed, -50, 850);
+                ys[i] = randomInt(seed, -50, 650);
+                ws[i] = randomInt(seed, 1, 120);
+                hs[i] = randomInt(seed, 1, 120);
+                cxs[i] = (float)randomInt(seed, -50, 850);
+                cys[i] = (float)randomInt(seed, -50, 650);
+            }
+            SDL_Rect box{randomInt(seed, -50, 850), randomInt(seed, -50, 650), randomInt(seed, 1, 200),
+                         randomInt(seed, 1, 200)};
+            Circle circle((float)randomInt(seed, -50, 850), (float)randomInt(seed, -50, 650),
+                          (float)randomInt(seed, 1, 150));
+            float shotRadius = (float)randomInt(seed, 1, 40);
+
+            const char* failed = nullptr;
+            CollisionKernels::boxVsBoxes(box, xs.data(), ys.data(), ws.data(), hs.data(), count, hitMask.data());
+            for (int i = 0; i < count && !failed; ++i) {
+                SDL_Rect other{xs[i], ys[i], ws[i], hs[i]};
+                if (CollisionKernels::isHit(hitMask.data(), i) != checkCollision(box, other)) {
+                    failed = "boxVsBoxes";
+                }
+            }
+            CollisionKernels::circleVsBoxes(circle.x, circle.y, circle.r, xs.data(), ys.data(), ws.data(), hs.data(),
+                                            count, hitMask.data());
+            for (int i = 0; i < count && !failed; ++i) {
+                SDL_Rect other{xs[i], ys[i], ws[i], hs[i]};
+                if (CollisionKernels::isHit(hitMask.data(), i) != checkCollision(circle, other)) {
+                    failed = "circleVsBoxes";
+                }
+            }
+            CollisionKernels::boxVsCircles((float)box.x, (float)box.y, (float)(box.x + box.w), (float)(box.y + box.h),
+                                           shotRadius, cxs.data(), cys.data(), count, hitMask.data());
+            for (int i = 0; i < count && !failed; ++i) {
+                Circle shot(cxs[i], cys[i], shotRadius);
+                if (CollisionKernels::isHit(hitMask.data(), i) != checkCollision(shot, box)) {
+                    failed = "boxVsCircles";
+                }
+            }
+
+            if (failed) {
+                std::cerr << "CollisionKernels::" << failed << " (" << CollisionKernels::getBackend()
+                          << ") disagrees with checkCollision (round " << round << ")" << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main() {
+    bool passed = checkSpatialHash();
+
+    // Every kernel backend this build and CPU can run, not only the one detection picks
+    const char* backends[] = {"avx2", "sse2", "scalar"};
+    for (const char* backend : backends) {
+        if (CollisionKernels::setBackend(backend)) {
+            passed = checkCollisionKernels() && passed;
+            std::cout << "Checked collision kernels: " << backend << std::endl;
+        }
+    }
+    CollisionKernels::setBackend(nullptr);
+
+    if (!passed) {
+        return 1;
+    }
+    std::cout << "Collision checks passed" << std::endl;
+    return 0;
+}
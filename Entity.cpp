@@ -1,30 +1,37 @@
 #include "Entity.h"
 #include "GameUnits.h"
 
-Entity::Entity(float x, float y, float w, float h, float health)
-    : m_position(GameUnits::toMeters(x), GameUnits::toMeters(y)),
-      m_width(GameUnits::toMeters(w)), 
-      m_height(GameUnits::toMeters(h)),
-      m_maxHealth(health), m_currentHealth(health), m_alive(true) {}
+Entity::Entity(EntityStore& store, float x, float y, float w, float h, float health)
+    : m_store(store),
+      m_handle(store.create(Vector2D(GameUnits::toMeters(x), GameUnits::toMeters(y)),
+                            Vector2D(GameUnits::toMeters(w), GameUnits::toMeters(h)),
+                            health)) {}
+
+Entity::~Entity() {
+    m_store.destroy(m_handle);
+}
 
 void Entity::takeDamage(float damage) {
-    m_currentHealth -= damage;
-    if (m_currentHealth <= 0) {
-        m_currentHealth = 0;
-        m_alive = false;
+    float& current = health();
+    current -= damage;
+    if (current <= 0) {
+        current = 0;
+        m_store.setAlive(m_handle.index, false);
     }
 }
 
 SDL_Rect Entity::getCollisionBox() const {
-    Vector2D pixelPos = GameUnits::toPixels(m_position);
+    return getCollisionBoxAt(position());
+}
+
+SDL_Rect Entity::getCollisionBoxAt(const Vector2D& at) const {
+    Vector2D pixelPos = GameUnits::toPixels(at);
+    float width = GameUnits::toPixels(getWidth());
+    float height = GameUnits::toPixels(getHeight());
     return SDL_Rect{
-        (int)(pixelPos.x - GameUnits::toPixels(m_width) / 2),
-        (int)(pixelPos.y - GameUnits::toPixels(m_height) / 2),
-        (int)GameUnits::toPixels(m_width),
-        (int)GameUnits::toPixels(m_height)
+        (int)(pixelPos.x - width / 2),
+        (int)(pixelPos.y - height / 2),
+        (int)width,
+        (int)height
     };
 }
-
-
-
-
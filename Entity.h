@@ -2,43 +2,77 @@
 #define ENTITY_H
 
 #include "Vector2D.h"
+#include "EntityStore.h"
 #include <SDL2/SDL.h>
 
+class Renderer;
+
 struct Circle {
     float x, y, r;
     Circle(float x, float y, float r = 0) 
        : x(x), y(y), r(r) {}
 };
 
+// A blade turning about its base over one tick: the sector from startAngle through
+// startAngle + sweep (radians, either sign), padded by halfWidth. Pixels.
+struct SwordArc {
+    float x, y;
+    float length;
+    float startAngle;
+    float sweep;
+    float halfWidth;
+};
+
+// A combatant's view over its slot in an EntityStore. The shared component
+// state (position, velocity, extents, health, animation state) lives in the
+// store's arrays; subclasses keep only what is specific to them.
 class Entity {
+private:
+    EntityStore& m_store;
+    EntityHandle m_handle;
+
 protected:
-    Vector2D m_position;
-    Vector2D m_velocity;
-    float m_width;
-    float m_height;
-    float m_maxHealth;
-    float m_currentHealth;
-    bool m_alive;
+    Vector2D& position() { return m_store.position(m_handle.index); }
+    const Vector2D& position() const { return m_store.position(m_handle.index); }
+    Vector2D& velocity() { return m_store.velocity(m_handle.index); }
+    const Vector2D& velocity() const { return m_store.velocity(m_handle.index); }
+    float& health() { return m_store.health(m_handle.index); }
+    float health() const { return m_store.health(m_handle.index); }
+
+    // Subclasses store their state enum here, cast to int
+    int getAnimStateValue() const { return m_store.animState(m_handle.index); }
+    void setAnimStateValue(int state) { m_store.animState(m_handle.index) = state; }
+
+    // Range EntityStore::integrate keeps this entity's centre in (meters)
+    void setMoveBounds(const Vector2D& min, const Vector2D& max) { m_store.setMoveBounds(m_handle.index, min, max); }
    
 public:
-    Entity(float x, float y, float w, float h, float health);
-    virtual ~Entity() = default;
+    Entity(EntityStore& store, float x, float y, float w, float h, float health);
+    virtual ~Entity();
+
+    Entity(const Entity&) = delete;
+    Entity& operator=(const Entity&) = delete;
     
-    virtual void update(float deltaTime) = 0;
-    virtual void render(SDL_Renderer* renderer) = 0;
+    virtual void update(float deltaTime) = 0;  // Behaviour; sets velocity() for the store to integrate
+    virtual void onMoved() {}                   // After integrate(): refresh anything derived from position
+    virtual void render(Renderer& renderer) = 0;
     
     virtual void takeDamage(float damage);
-    bool isAlive() const { return m_alive; }
+    bool isAlive() const { return m_store.isAlive(m_handle.index); }
+    EntityHandle getHandle() const { return m_handle; }
     
-    Vector2D getPosition() const { return m_position; }
+    Vector2D getPosition() const { return position(); }
     SDL_Rect getCollisionBox() const;
-    float getHealthPercentage() const { return m_currentHealth / m_maxHealth; }
+    SDL_Rect getCollisionBoxAt(const Vector2D& at) const;  // As if the entity stood at `at` (meters)
+    float getHealthPercentage() const { return health() / getMaxHealth(); }
+    float getHealth() const { return health(); }
+    float getMaxHealth() const { return m_store.maxHealth(m_handle.index); }
     
     // Getters for dimensions
-    float getWidth() const { return m_width; }
-    float getHeight() const { return m_height; }
+    float getWidth() const { return m_store.extent(m_handle.index).x; }
+    float getHeight() const { return m_store.extent(m_handle.index).y; }
     
-    void setPosition(Vector2D& newPosition) { m_position = newPosition; };
+    void setPosition(Vector2D& newPosition) { position() = newPosition; };
 };
 
 #endif
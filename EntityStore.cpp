@@ -0,0 +1,81 @@
+#include "EntityStore.h"
+#include <algorithm>
+#include <cfloat>
+
+void EntityStore::reserve(size_t slots) {
+    m_positions.reserve(slots);
+    m_velocities.reserve(slots);
+    m_extents.reserve(slots);
+    m_moveMin.reserve(slots);
+    m_moveMax.reserve(slots);
+    m_health.reserve(slots);
+    m_maxHealth.reserve(slots);
+    m_alive.reserve(slots);
+    m_animStates.reserve(slots);
+    m_generations.reserve(slots);
+    m_used.reserve(slots);
+}
+
+EntityHandle EntityStore::create(const Vector2D& position, const Vector2D& extent, float health) {
+    Uint32 index;
+    if (!m_freeSlots.empty()) {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        index = static_cast<Uint32>(m_used.size());
+        m_positions.emplace_back();
+        m_velocities.emplace_back();
+        m_extents.emplace_back();
+        m_moveMin.emplace_back();
+        m_moveMax.emplace_back();
+        m_health.push_back(0.0f);
+        m_maxHealth.push_back(0.0f);
+        m_alive.push_back(0);
+        m_animStates.push_back(0);
+        m_generations.push_back(0);
+        m_used.push_back(0);
+    }
+
+    m_positions[index] = position;
+    m_velocities[index] = Vector2D(0, 0);
+    m_extents[index] = extent;
+    m_moveMin[index] = Vector2D(-FLT_MAX, -FLT_MAX);  // Unbounded until the owner says otherwise
+    m_moveMax[index] = Vector2D(FLT_MAX, FLT_MAX);
+    m_health[index] = health;
+    m_maxHealth[index] = health;
+    m_alive[index] = 1;
+    m_animStates[index] = 0;
+    m_used[index] = 1;
+    ++m_count;
+
+    return EntityHandle{index, m_generations[index]};
+}
+
+void EntityStore::destroy(EntityHandle handle) {
+    if (!isValid(handle)) return;
+
+    m_used[handle.index] = 0;
+    m_alive[handle.index] = 0;
+    ++m_generations[handle.index];
+    m_freeSlots.push_back(handle.index);
+    --m_count;
+}
+
+bool EntityStore::isValid(EntityHandle handle) const {
+    return handle.index < m_used.size() && m_used[handle.index] &&
+           m_generations[handle.index] == handle.generation;
+}
+
+void EntityStore::integrate(float deltaTime) {
+    Vector2D* positions = m_positions.data();
+    const Vector2D* velocities = m_velocities.data();
+    const Vector2D* moveMin = m_moveMin.data();
+    const Vector2D* moveMax = m_moveMax.data();
+    for (size_t i = 0; i < m_used.size(); ++i) {
+        if (!m_used[i]) continue;
+        Vector2D position = positions[i] + velocities[i] * deltaTime;
+        position.x = std::max(moveMin[i].x, std::min(moveMax[i].x, position.x));
+        position.y = std::max(moveMin[i].y, std::min(moveMax[i].y, position.y));
+        positions[i] = position;
+    }
+}
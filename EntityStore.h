@@ -0,0 +1,83 @@
+#ifndef ENTITY_STORE_H
+#define ENTITY_STORE_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include "Vector2D.h"
+
+// Names a slot in an EntityStore. The generation changes every time the slot
+// is freed, so a handle kept past its entity's lifetime is detectably stale.
+struct EntityHandle {
+    Uint32 index;
+    Uint32 generation;
+};
+
+// Combatant state kept as parallel component arrays (structure of arrays), so
+// systems that touch one component over many entities walk contiguous memory.
+// Slots are recycled through a free list; indices of live entities never move.
+class EntityStore {
+private:
+    std::vector<Vector2D> m_positions;   // Meters
+    std::vector<Vector2D> m_velocities;  // Meters per second
+    std::vector<Vector2D> m_extents;     // Width and height, meters
+    std::vector<Vector2D> m_moveMin;     // Where integrate() keeps each centre, meters
+    std::vector<Vector2D> m_moveMax;
+    std::vector<float> m_health;
+    std::vector<float> m_maxHealth;
+    std::vector<Uint8> m_alive;          // Health above zero (a dead entity still holds its slot)
+    std::vector<int> m_animStates;       // Owner-defined state enum
+
+    std::vector<Uint32> m_generations;
+    std::vector<Uint8> m_used;           // Slot holds an entity
+    std::vector<Uint32> m_freeSlots;
+    size_t m_count;
+
+public:
+    EntityStore() : m_count(0) {}
+
+    EntityStore(const EntityStore&) = delete;
+    EntityStore& operator=(const EntityStore&) = delete;
+
+    void reserve(size_t slots);
+    EntityHandle create(const Vector2D& position, const Vector2D& extent, float health);
+    void destroy(EntityHandle handle);  // Ignores stale handles
+    bool isValid(EntityHandle handle) const;
+
+    // The movement system: one pass over the position and velocity columns,
+    // moving every live entity by velocity * deltaTime and clamping it to its
+    // move bounds. Entities only choose their velocities in update().
+    void integrate(float deltaTime);
+
+    size_t size() const { return m_count; }                // Live entities
+    size_t getSlotCount() const { return m_used.size(); }  // Bound for iterating the columns
+    bool isUsed(size_t index) const { return m_used[index] != 0; }
+
+    // Per-entity access, by slot index
+    Vector2D& position(Uint32 index) { return m_positions[index]; }
+    const Vector2D& position(Uint32 index) const { return m_positions[index]; }
+    Vector2D& velocity(Uint32 index) { return m_velocities[index]; }
+    const Vector2D& velocity(Uint32 index) const { return m_velocities[index]; }
+    const Vector2D& extent(Uint32 index) const { return m_extents[index]; }
+    void setMoveBounds(Uint32 index, const Vector2D& min, const Vector2D& max) {
+        m_moveMin[index] = min;
+        m_moveMax[index] = max;
+    }
+    float& health(Uint32 index) { return m_health[index]; }
+    float health(Uint32 index) const { return m_health[index]; }
+    float maxHealth(Uint32 index) const { return m_maxHealth[index]; }
+    bool isAlive(Uint32 index) const { return m_alive[index] != 0; }
+    void setAlive(Uint32 index, bool alive) { m_alive[index] = alive ? 1 : 0; }
+    int& animState(Uint32 index) { return m_animStates[index]; }
+    int animState(Uint32 index) const { return m_animStates[index]; }
+
+    // Whole columns, getSlotCount() long; skip slots where isUsed() is false
+    Vector2D* getPositions() { return m_positions.data(); }
+    const Vector2D* getPositions() const { return m_positions.data(); }
+    Vector2D* getVelocities() { return m_velocities.data(); }
+    const Vector2D* getExtents() const { return m_extents.data(); }
+    float* getHealth() { return m_health.data(); }
+    const Uint8* getAlive() const { return m_alive.data(); }
+    const int* getAnimStates() const { return m_animStates.data(); }
+};
+
+#endif
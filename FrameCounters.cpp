@@ -0,0 +1,72 @@
+#include "FrameCounters.h"
+#include <cstdlib>
+#include <new>
+
+namespace {
+    thread_local long long t_drawCalls = 0;
+    thread_local long long t_allocations = 0;
+    thread_local bool t_paused = false;
+
+    void* allocate(std::size_t size) {
+        if (!t_paused) ++t_allocations;
+        if (size == 0) size = 1;
+
+        while (true) {
+            void* memory = std::malloc(size);
+            if (memory) return memory;
+
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) throw std::bad_alloc();
+            handler();
+        }
+    }
+}
+
+namespace FrameCounters {
+
+void addDrawCalls(int count) {
+    if (!t_paused) t_drawCalls += count;
+}
+
+long long getDrawCalls() {
+    return t_drawCalls;
+}
+
+long long getAllocations() {
+    return t_allocations;
+}
+
+ScopedPause::ScopedPause() : m_wasPaused(t_paused) {
+    t_paused = true;
+}
+
+ScopedPause::~ScopedPause() {
+    t_paused = m_wasPaused;
+}
+
+}
+
+// Counting replacements for the global allocation functions
+void* operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate(size);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
@@ -0,0 +1,28 @@
+#ifndef FRAME_COUNTERS_H
+#define FRAME_COUNTERS_H
+
+// Running per-thread counts of renderer draw calls and C++ heap allocations.
+// The profiler samples them at frame boundaries to get per-frame figures.
+// Allocations are counted by the global operator new in FrameCounters.cpp,
+// so allocations made inside SDL/TTF (malloc) are not included.
+namespace FrameCounters {
+    void addDrawCalls(int count = 1);
+    long long getDrawCalls();
+    long long getAllocations();
+
+    // Stops counting on this thread while in scope, so debug overlays can
+    // draw without showing up in the numbers they display
+    class ScopedPause {
+    public:
+        ScopedPause();
+        ~ScopedPause();
+
+        ScopedPause(const ScopedPause&) = delete;
+        ScopedPause& operator=(const ScopedPause&) = delete;
+
+    private:
+        bool m_wasPaused;
+    };
+}
+
+#endif
@@ -5,9 +5,19 @@
 #include "Sif.h"
 #include "Renderer.h"
 #include "InputHandler.h"
+#include "InputRecording.h"
+#include "AssetLoader.h"
+#include "AssetBundle.h"
 #include "LTexture.h"
+#include "TextureCache.h"
+#include "Trace.h"
 #include <SDL2/SDL_image.h>
+#include <cmath>
 #include <iostream>
+#include <random>
+
+static const char* PLAYER_SPRITE_SHEET = "assets/sprites/player/player_master_spritesheet.png";
+static const char* DEFAULT_ASSET_BUNDLE = "assets/assets.bundle";
 
 // Helper function for AABB collision detection
 bool checkCollision(const SDL_Rect& a, const SDL_Rect& b) {
@@ -39,11 +49,10 @@ bool checkCollision(const Circle& a, const SDL_Rect& b) {
         cY = a.y;
     }
     
-    Vector2D centre{a.x, a.y};
-    Vector2D point{cX, cY};
-
-    //If the closest point is inside the circle
-    if (centre.distance(point) < a.r) {
+    //If the closest point is inside the circle (squared, so no sqrt)
+    float dx = a.x - cX;
+    float dy = a.y - cY;
+    if (dx * dx + dy * dy < a.r * a.r) {
         //This box and the circle have collided
         return true;
     }
@@ -52,6 +61,127 @@ bool checkCollision(const Circle& a, const SDL_Rect& b) {
     return false;
 }
 
+// Does the segment from the origin to (dx, dy) pass through the box (coordinates relative to that origin)?
+static bool segmentHitsBox(float dx, float dy, float left, float top, float right, float bottom) {
+    float entry = 0.0f;
+    float exit = 1.0f;
+    if (dx == 0.0f) {
+        if (left >= 0.0f || right <= 0.0f) return false;
+    } else {
+        entry = std::max(entry, std::min(left / dx, right / dx));
+        exit = std::min(exit, std::max(left / dx, right / dx));
+    }
+    if (dy == 0.0f) {
+        if (top >= 0.0f || bottom <= 0.0f) return false;
+    } else {
+        entry = std::max(entry, std::min(top / dy, bottom / dy));
+        exit = std::min(exit, std::max(top / dy, bottom / dy));
+    }
+    return entry < exit;
+}
+
+// The sector and the box overlap when one holds the other (the base is in the box, or a
+// corner is in the sector) or their outlines cross: a straight edge of the sector through
+// the box, or the arc through a box side. Padding the box by halfWidth pads the blade.
+bool checkCollision(const SwordArc& a, const SDL_Rect& b) {
+    constexpr float TWO_PI = 6.28318530718f;
+
+    // Box relative to the sword base
+    float left = b.x - a.halfWidth - a.x;
+    float top = b.y - a.halfWidth - a.y;
+    float right = b.x + b.w + a.halfWidth - a.x;
+    float bottom = b.y + b.h + a.halfWidth - a.y;
+    if (left < 0.0f && right > 0.0f && top < 0.0f && bottom > 0.0f) {
+        return true;
+    }
+
+    float start = a.sweep < 0.0f ? a.startAngle + a.sweep : a.startAngle;
+    float sweep = std::abs(a.sweep);
+    auto inSweep = [start, sweep](float x, float y) {
+        float offset = std::atan2(y, x) - start;
+        offset -= TWO_PI * std::floor(offset / TWO_PI);
+        return sweep >= TWO_PI || offset <= sweep;
+    };
+
+    float lengthSquared = a.length * a.length;
+    const float xs[2] = {left, right};
+    const float ys[2] = {top, bottom};
+    for (float x : xs) {
+        for (float y : ys) {
+            if (x * x + y * y <= lengthSquared && inSweep(x, y)) return true;
+        }
+    }
+
+    // The blade where the sweep began and where it ended
+    const float edges[2] = {start, start + sweep};
+    for (float angle : edges) {
+        if (segmentHitsBox(std::cos(angle) * a.length, std::sin(angle) * a.length, left, top, right, bottom)) {
+            return true;
+        }
+    }
+
+    // The tip's path crossing a side of the box
+    for (float x : xs) {
+        if (x * x >= lengthSquared) continue;
+        float h = std::sqrt(lengthSquared - x * x);
+        if (-h > top && -h < bottom && inSweep(x, -h)) return true;
+        if (h > top && h < bottom && inSweep(x, h)) return true;
+    }
+    for (float y : ys) {
+        if (y * y >= lengthSquared) continue;
+        float w = std::sqrt(lengthSquared - y * y);
+        if (-w > left && -w < right && inSweep(-w, y)) return true;
+        if (w > left && w < right && inSweep(w, y)) return true;
+    }
+    return false;
+}
+
+// Swept AABB: a is where the box started the tick, then moved (dx, dy) pixels relative to b.
+// Slab test on each axis; the box touched b while both axes' entry/exit windows overlap.
+bool sweepCollision(const SDL_Rect& a, float dx, float dy, const SDL_Rect& b, float& timeOfImpact) {
+    float entry = 0.0f;
+    float exit = 1.0f;
+
+    if (dx == 0.0f) {
+        if (a.x >= b.x + b.w || a.x + a.w <= b.x) return false;
+    } else {
+        float t1 = (b.x - (a.x + a.w)) / dx;  // Leading edges meet
+        float t2 = (b.x + b.w - a.x) / dx;    // Trailing edges part
+        entry = std::max(entry, std::min(t1, t2));
+        exit = std::min(exit, std::max(t1, t2));
+    }
+
+    if (dy == 0.0f) {
+        if (a.y >= b.y + b.h || a.y + a.h <= b.y) return false;
+    } else {
+        float t1 = (b.y - (a.y + a.h)) / dy;
+        float t2 = (b.y + b.h - a.y) / dy;
+        entry = std::max(entry, std::min(t1, t2));
+        exit = std::min(exit, std::max(t1, t2));
+    }
+
+    // Only touching for an instant does not count, matching checkCollision
+    if (entry >= exit) return false;
+    timeOfImpact = entry;
+    return true;
+}
+
+// Everything a box covered while moving (dx, dy) pixels into rect, for broad phase queries
+static SDL_Rect sweptBounds(const SDL_Rect& rect, float dx, float dy) {
+    int x0 = std::min(rect.x, (int)std::floor(rect.x - dx));
+    int y0 = std::min(rect.y, (int)std::floor(rect.y - dy));
+    int x1 = std::max(rect.x + rect.w, (int)std::ceil(rect.x + rect.w - dx));
+    int y1 = std::max(rect.y + rect.h, (int)std::ceil(rect.y + rect.h - dy));
+    return SDL_Rect{x0, y0, x1 - x0, y1 - y0};
+}
+
+// Square around everything the blade can reach from its base, for broad phase queries
+static SDL_Rect arcBounds(const SwordArc& arc) {
+    float reach = arc.length + arc.halfWidth;
+    return SDL_Rect{(int)std::floor(arc.x - reach), (int)std::floor(arc.y - reach),
+                    (int)std::ceil(reach * 2.0f) + 1, (int)std::ceil(reach * 2.0f) + 1};
+}
+
 // Helper function to push entities apart
 void separateEntities(Vector2D& pos1, Vector2D& pos2, float radius1, float radius2) {
     Vector2D diff = pos1 - pos2;
@@ -69,13 +199,20 @@ void separateEntities(Vector2D& pos1, Vector2D& pos2, float radius1, float radiu
     }
 }
 
-Game::Game() : m_isRunning(false), m_window(nullptr), m_renderer(nullptr), m_lastTime(0) {}
+Game::Game() : m_isRunning(false), m_headless(false), m_width(0), m_height(0), m_seed(0),
+               m_window(nullptr), m_renderer(nullptr), m_textureBudget(TextureCache::DEFAULT_BUDGET_BYTES),
+               m_bundlePath(DEFAULT_ASSET_BUNDLE),
+               m_lastTime(0), m_loadStartCounter(0), m_tick(0) {}
 
 Game::~Game() {
     clean();
 }
 
 bool Game::init(const char* title, int width, int height) {
+    m_width = width;
+    m_height = height;
+    m_seed = std::random_device{}();
+
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         std::cerr << "SDL initialization failed: " << SDL_GetError() << std::endl;
         return false;
@@ -107,28 +244,25 @@ bool Game::init(const char* title, int width, int height) {
 
     // Set the global renderer for LTexture
     LTexture::setRenderer(m_renderer);
+    m_textureCache = std::make_unique<TextureCache>(m_textureBudget);
 
-    // Load player sprite
-    if (!Player::loadTexture(m_renderer, "assets/sprites/player/player_master_spritesheet.png")) {
-        std::cerr << "Warning: Failed to load player sprite, using fallback rendering" << std::endl;
-        // Game can still continue with rectangle rendering
+    // Upload straight from the baked bundle when there is one. Otherwise decode the
+    // sprite sheet and read the font file in the background; render() shows a loading
+    // screen and uploads the results, then finishLoading() builds the Renderer.
+    m_loadStartCounter = SDL_GetPerformanceCounter();
+    if (!loadAssetBundle()) {
+        m_loader = std::make_unique<AssetLoader>();
+        m_loader->queueSpriteSheet(PLAYER_SPRITE_SHEET, Player::getFrameWidth(), Player::getFrameHeight());
+        m_loader->queueFontFile();
+        m_loader->start();
     }
 
-    // Initialize game objects
-    m_player = std::make_unique<Player>(width / 2.0f, height * 0.75f);
-    m_player->setWindowBounds(width, height);
-    m_boss = std::make_unique<Boss>(width / 2.0f, height * 0.25f);
-    
-    // Initialize Sif AI
-    m_sifAI = std::make_unique<HolySwordWolfAI>(m_boss.get(), m_player.get());
-
-    // Enable AI debug by default
-    m_sifAI->setDebugEnabled(false);
+    createFight();
     
-    m_gameRenderer = std::make_unique<Renderer>(m_renderer, width, height);
     m_inputHandler = std::make_unique<InputHandler>();
     
     m_lastTime = SDL_GetTicks();
+    m_profiler.setEnabled(true);
     m_isRunning = true;
     
     std::cout << "=== AI Debug System Active ===" << std::endl;
@@ -140,23 +274,140 @@ bool Game::init(const char* title, int width, int height) {
     return true;
 }
 
+bool Game::initHeadless(int width, int height, unsigned int seed) {
+    m_headless = true;
+    m_width = width;
+    m_height = height;
+    m_seed = seed;
+
+    createFight();
+
+    m_isRunning = true;
+    return true;
+}
+
+void Game::createFight() {
+    // Initialize game objects
+    m_player = std::make_unique<Player>(m_entities, m_width / 2.0f, m_height * 0.75f);
+    m_player->setWindowBounds(m_width, m_height);
+    m_boss = std::make_unique<Boss>(m_entities, m_width / 2.0f, m_height * 0.25f);
+    
+    // Initialize Sif AI
+    m_sifAI = std::make_unique<HolySwordWolfAI>(m_boss.get(), m_player.get(), m_seed);
+
+    // Enable AI debug by default
+    m_sifAI->setDebugEnabled(false);
+
+    m_projectiles.clear();
+    m_collisionGrid.setBounds(m_width, m_height);
+
+    m_pendingInput = PlayerInput();
+    m_tick = 0;
+}
+
+void Game::rebuildCollisionGrid() {
+    m_collisionGrid.clear();
+    m_collisionGrid.insert(m_player->getCollisionBox(), CollisionLayer::PLAYER_BODY, 0);
+    m_collisionGrid.insert(m_boss->getCollisionBox(), CollisionLayer::BOSS_BODY, 0);
+    for (int i = 0; i < m_projectiles.size(); ++i) {
+        Uint32 layer = m_projectiles.getOwners()[i] == ProjectileOwner::BOSS ? CollisionLayer::BOSS_SHOT
+                                                                              : CollisionLayer::PLAYER_SHOT;
+        m_collisionGrid.insert(m_projectiles.getBounds(i), layer, i);
+    }
+    m_collisionGrid.build();
+}
+
+void Game::fireBossProjectiles() {
+    const float speed = 12.0f;     // Meters per second
+    const float lifetime = 3.0f;   // Seconds
+    const float spread = 0.15f;    // Radians between shots of a fan
+
+    // Enhanced Sif throws a fan instead of a single bolt
+    int shots = m_sifAI->isEnhanced() ? 9 : 1;
+    Vector2D origin = m_boss->getSwordTip();
+    Vector2D aim = m_player->getPosition() - origin;
+    float angle = std::atan2(aim.y, aim.x) - spread * (shots - 1) / 2.0f;
+
+    for (int i = 0; i < shots; ++i, angle += spread) {
+        Vector2D velocity(std::cos(angle) * speed, std::sin(angle) * speed);
+        m_projectiles.spawn(origin, velocity, m_boss->getAttackDamage(), lifetime, ProjectileOwner::BOSS);
+    }
+}
+
+bool Game::isFightOver() const {
+    return !m_player->isAlive() || !m_boss->isAlive();
+}
+
+void Game::resetFight(unsigned int seed) {
+    // AI holds raw pointers to the entities, so it goes first
+    m_sifAI.reset();
+    m_seed = seed;
+    createFight();
+}
+
+void Game::startRecording(float fixedStep) {
+    m_replay.reset();
+    resetFight(m_seed);
+    m_recording = std::make_unique<InputRecording>(m_seed, fixedStep);
+}
+
+void Game::startReplay(const InputRecording& recording) {
+    m_recording.reset();
+    resetFight(recording.getSeed());
+    m_replay = std::make_unique<InputRecording>(recording);
+}
+
+bool Game::isReplayFinished() const {
+    return m_replay && (size_t)m_tick >= m_replay->getTickCount();
+}
+
+Uint32 Game::getStateChecksum() const {
+    // FNV-1a over the raw bits of the state that matters for the outcome
+    float state[] = {
+        m_player->getPosition().x, m_player->getPosition().y, m_player->getHealth(),
+        m_player->getStaminaPercentage(),
+        m_boss->getPosition().x, m_boss->getPosition().y, m_boss->getHealth(),
+        (float)m_sifAI->getAggressionLevel(), (float)m_tick
+    };
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(state);
+    Uint32 hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(state); ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
 void Game::handleEvents() {
+    if (m_headless) return;
+
+    ScopedTimer eventsTimer(m_profiler, ProfilePhase::HANDLE_EVENTS);
+
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
         // Pass event to input handler FIRST
         m_inputHandler->handleEvent(event);
 
-        if (event.type == SDL_QUIT) {
+        // Quitting works while assets are still loading; only the renderer's own
+        // toggles wait for the Renderer to exist
+        if (event.type == SDL_QUIT ||
+            (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_CLOSE)) {
             m_isRunning = false;
+        } else if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET) {
+            if (m_gameRenderer) m_gameRenderer->invalidateCaches();  // Cached layers lost their contents
         } else if (event.type == SDL_KEYDOWN) {
-            if (event.key.keysym.sym == SDLK_d && event.key.keysym.mod & KMOD_CTRL) {
+            if (!m_gameRenderer && (event.key.keysym.sym == SDLK_d || event.key.keysym.sym == SDLK_p)) {
+                continue;  // Still loading
+            } else if (event.key.keysym.sym == SDLK_d && event.key.keysym.mod & KMOD_CTRL) {
                 m_gameRenderer->toggleDebugMode();  // Ctrl+D for debug mode
                 std::cout << "[Debug] Visual debug mode: " << (m_gameRenderer->isDebugMode() ? "ON" : "OFF") << std::endl;
             }
             // Add special effect toggle for testing
             else if (event.key.keysym.sym == SDLK_e && event.key.keysym.mod & KMOD_CTRL) {
-                m_sifAI->setEnhanced(!m_sifAI->isEnhanced());  // Ctrl+E to toggle enhanced mode
-                std::cout << "[AI] Enhanced mode: " << (m_sifAI->isEnhanced() ? "ON" : "OFF") << std::endl;
+                m_pendingInput.toggleEnhanced = true;  // Ctrl+E to toggle enhanced mode
+            }
+            else if (event.key.keysym.sym == SDLK_p && event.key.keysym.mod & KMOD_CTRL) {
+                m_gameRenderer->togglePerfHUD();  // Ctrl+P for the performance HUD
+                std::cout << "[Debug] Performance HUD: " << (m_gameRenderer->isPerfHUDVisible() ? "ON" : "OFF") << std::endl;
             }
             // Toggle AI debug logging
             else if (event.key.keysym.sym == SDLK_a && event.key.keysym.mod & KMOD_CTRL) {
@@ -167,43 +418,100 @@ void Game::handleEvents() {
         }
     }
     
-    // Handle player input
-    Vector2D moveDir = m_inputHandler->getMovementDirection();
-    m_player->move(moveDir);
+    // Latch player input; presses are held until a simulation tick consumes them,
+    // so they are not lost on frames that run zero ticks
+    m_pendingInput.moveDir = m_inputHandler->getMovementDirection();
+    m_pendingInput.attack = m_pendingInput.attack || m_inputHandler->isAttackPressed();
+    m_pendingInput.dodge = m_pendingInput.dodge || m_inputHandler->isDodgePressed();
+
+    m_inputHandler->update();
+}
+
+void Game::applyPlayerInput(const PlayerInput& input) {
+    if (input.toggleEnhanced) {
+        m_sifAI->setEnhanced(!m_sifAI->isEnhanced());
+        if (!m_headless) {
+            std::cout << "[AI] Enhanced mode: " << (m_sifAI->isEnhanced() ? "ON" : "OFF") << std::endl;
+        }
+    }
+
+    m_player->move(input.moveDir);
     
-    if (m_inputHandler->isAttackPressed()) {
+    if (input.attack) {
         m_player->attack();
     }
     
-    if (m_inputHandler->isDodgePressed() && moveDir.length() > 0) {
-        m_player->dodge(moveDir);
+    if (input.dodge && input.moveDir.length() > 0) {
+        m_player->dodge(input.moveDir);
     }
-
-    m_inputHandler->update();
 }
 
 void Game::update(float deltaTime) {
-    if (!m_player->isAlive() || !m_boss->isAlive()) {
+    if (m_loader) return;  // The fight starts once assets are in
+
+    ScopedTimer updateTimer(m_profiler, ProfilePhase::UPDATE);
+
+    PlayerInput input = m_pendingInput;
+    m_pendingInput.attack = false;
+    m_pendingInput.dodge = false;
+    m_pendingInput.toggleEnhanced = false;
+
+    if (m_replay) {
+        input = isReplayFinished() ? PlayerInput() : m_replay->getInput((size_t)m_tick);
+    }
+    if (m_recording) {
+        m_recording->record(input);
+    }
+
+    applyPlayerInput(input);
+    ++m_tick;
+
+    if (isFightOver()) {
         // Game over
         return;
     }
     
     // Update AI first (it will command the boss)
-    m_sifAI->update(deltaTime);
+    {
+        ScopedTimer aiTimer(m_profiler, ProfilePhase::UPDATE_AI);
+        m_sifAI->update(deltaTime);
+    }
 
-    // Store positions before update for collision resolution
-    // Vector2D playerPosBeforeUpdate = m_player->getPosition();
-    // Vector2D bossPosBeforeUpdate = m_boss->getPosition();
+    // Store positions before update; the swept tests below need the whole move
+    Vector2D playerPosBeforeUpdate = m_player->getPosition();
+    Vector2D bossPosBeforeUpdate = m_boss->getPosition();
 
     // Update entities
-    m_player->update(deltaTime);
-    m_boss->update(deltaTime);
+    {
+        ScopedTimer entityTimer(m_profiler, ProfilePhase::UPDATE_ENTITIES);
+        m_player->update(deltaTime);
+        m_boss->update(deltaTime);
+        m_entities.integrate(deltaTime);
+        m_player->onMoved();
+        m_boss->onMoved();
+        m_projectiles.update(deltaTime, GameUnits::toMeters((float)m_width), GameUnits::toMeters((float)m_height));
+    }
+
+    ScopedTimer collisionTimer(m_profiler, ProfilePhase::UPDATE_COLLISION);
+
+    // Every check below asks the grid only about the layers it can hit
+    rebuildCollisionGrid();
+
+    // How far the player moved relative to the boss this tick (pixels). A dodge or a
+    // boss step at the capped deltaTime covers several box widths, so each check below
+    // sweeps along it instead of only testing where things ended up.
+    Vector2D playerMove = m_player->getPosition() - playerPosBeforeUpdate;
+    Vector2D bossMove = m_boss->getPosition() - bossPosBeforeUpdate;
+    Vector2D relativeMove = GameUnits::toPixels(playerMove - bossMove);
+    float timeOfImpact = 0.0f;
 
     // Body-to-body collision between player and boss
     SDL_Rect playerBox = m_player->getCollisionBox();
     SDL_Rect bossBox = m_boss->getCollisionBox();
+    SDL_Rect playerStartBox = m_player->getCollisionBoxAt(playerPosBeforeUpdate);
+    SDL_Rect bossStartBox = m_boss->getCollisionBoxAt(bossPosBeforeUpdate);
     
-    if (checkCollision(playerBox, bossBox)) {
+    if (m_collisionGrid.overlapsAny(playerBox, CollisionLayer::BOSS_BODY)) {
         Vector2D playerPos = m_player->getPosition();
         Vector2D bossPos = m_boss->getPosition();
         
@@ -250,13 +558,36 @@ void Game::update(float deltaTime) {
         
         // Only update player position
         m_player->setPosition(newPlayerPos);
+    } else if (!checkCollision(playerStartBox, bossStartBox) &&
+               m_collisionGrid.overlapsAny(sweptBounds(playerBox, relativeMove.x, relativeMove.y),
+                                           CollisionLayer::BOSS_BODY) &&
+               sweepCollision(playerStartBox, relativeMove.x, relativeMove.y, bossStartBox, timeOfImpact) &&
+               timeOfImpact > 0.0f) {
+        // Passed through the boss inside the tick: stop where the bodies first touched
+        Vector2D newPlayerPos = m_boss->getPosition() + (playerPosBeforeUpdate - bossPosBeforeUpdate) +
+                                (playerMove - bossMove) * timeOfImpact;
+
+        // Keep player in bounds, as the push does
+        float playerHalfW = m_player->getWidth() / 2.0f;
+        float playerHalfH = m_player->getHeight() / 2.0f;
+        newPlayerPos.x = std::max(playerHalfW, std::min(GameUnits::toMeters(800.0f) - playerHalfW, newPlayerPos.x));
+        newPlayerPos.y = std::max(playerHalfH, std::min(GameUnits::toMeters(600.0f) - playerHalfH, newPlayerPos.y));
+        m_player->setPosition(newPlayerPos);
+        playerBox = m_player->getCollisionBox();
+        relativeMove = relativeMove * timeOfImpact;
     }
 
     // Check sword collisions
     // Player sword attack vs Boss body
     if (m_player->getState() == PlayerState::ATTACKING && !m_player->hasDealtDamage()) {
+        // The boss moves by -relativeMove as seen from the player's sword; it starts where it
+        // stood relative to the player at the start of the tick
         SDL_Rect playerSwordBox = m_player->getSwordHitbox();
-        if (checkCollision(playerSwordBox, bossBox)) {
+        SDL_Rect bossStartBoxBySword =
+            m_boss->getCollisionBoxAt(bossPosBeforeUpdate + (m_player->getPosition() - playerPosBeforeUpdate));
+        if (m_collisionGrid.overlapsAny(sweptBounds(playerSwordBox, relativeMove.x, relativeMove.y),
+                                        CollisionLayer::BOSS_BODY) &&
+            sweepCollision(bossStartBoxBySword, -relativeMove.x, -relativeMove.y, playerSwordBox, timeOfImpact)) {
             float damage = m_player->getAttackDamage();
             m_boss->takeDamage(damage);
             m_player->setDamageDealt();
@@ -266,14 +597,24 @@ void Game::update(float deltaTime) {
         }
     }
     
+    // The projectile attack throws once, at the start of its swing, instead of cutting
+    if (m_boss->isAttacking() && m_boss->getCurrentAttackAnim() == BossAttackAnim::PROJECTILE &&
+        !m_boss->hasDealtDamage()) {
+        fireBossProjectiles();
+        m_boss->setDamageDealt();
+    }
+
     // Boss sword attack vs Player body
     if (m_boss->isAttacking() && !m_player->isInvulnerable() && !m_boss->hasDealtDamage()) {
         bool isCollided = false;
         
-        // Check appropriate hitbox based on attack type
+        // Check appropriate hitbox based on attack type. The blade is tested over its whole turn
+        // since the last tick, against everywhere the player's body was during it.
         Circle attackCircle = m_boss->getAttackCircle();
-        SDL_Rect bossSwordBox = m_boss->getSwordHitbox();
-        isCollided = checkCollision(bossSwordBox, playerBox);
+        SwordArc bossSwordArc = m_boss->getSwordArc();
+        isCollided = m_collisionGrid.overlapsAny(sweptBounds(arcBounds(bossSwordArc), -relativeMove.x, -relativeMove.y),
+                                                 CollisionLayer::PLAYER_BODY) &&
+                     checkCollision(bossSwordArc, sweptBounds(playerBox, relativeMove.x, relativeMove.y));
         
         if (isCollided) {
             m_player->takeDamage(m_boss->getAttackDamage());
@@ -281,33 +622,207 @@ void Game::update(float deltaTime) {
         }
     }
     
-    // Check for projectiles (if player has projectile attacks)
-    // This is a placeholder - implement based on your Player class
-    /*
-    if (m_player->hasActiveProjectile()) {
-        Vector2D projectilePos = m_player->getProjectilePosition();
-        m_sifAI->OnProjectileDetected(projectilePos);
-    }
-    */
+    // Projectiles vs bodies; a dodge passes through them without using them up
+    if (!m_player->isInvulnerable()) {
+        m_hitCandidates.clear();
+        m_collisionGrid.query(playerBox, CollisionLayer::BOSS_SHOT, m_hitCandidates);
+        float projectileDamage = m_projectiles.collide(playerBox, m_hitCandidates);
+        if (projectileDamage > 0.0f) {
+            m_player->takeDamage(projectileDamage);
+        }
+    }
+    m_hitCandidates.clear();
+    m_collisionGrid.query(bossBox, CollisionLayer::PLAYER_SHOT, m_hitCandidates);
+    float bossProjectileDamage = m_projectiles.collide(bossBox, m_hitCandidates);
+    if (bossProjectileDamage > 0.0f) {
+        m_boss->takeDamage(bossProjectileDamage);
+        m_sifAI->onDamaged(bossProjectileDamage, m_player->getPosition());
+    }
+    m_projectiles.removeSpent();
+
+    // Sif reacts to each incoming shot once
+    m_projectiles.detectNew(ProjectileOwner::PLAYER, [this](const Vector2D& position) {
+        m_sifAI->onProjectileDetected(position);
+    });
 }
 
 void Game::render() {
+    if (m_headless) return;
+
+    ScopedTimer renderTimer(m_profiler, ProfilePhase::RENDER);
+
+    if (m_loader) {
+        m_loader->uploadReady(*m_textureCache);
+        if (!m_loader->isDone()) {
+            renderLoadingScreen();
+            return;
+        }
+        finishLoading();
+    }
+
     m_gameRenderer->clear();
     
-    m_player->render(m_renderer);
-    m_boss->render(m_renderer);
-    m_gameRenderer->drawDebugInfo(m_player.get(), m_boss.get());
-    m_gameRenderer->drawUI(m_player.get(), m_boss.get());
+    {
+        ScopedTimer entityTimer(m_profiler, ProfilePhase::RENDER_ENTITIES);
+        m_player->render(*m_gameRenderer);
+        m_boss->render(*m_gameRenderer);
+        m_gameRenderer->drawProjectiles(m_projectiles);
+    }
+    {
+        ScopedTimer debugTimer(m_profiler, ProfilePhase::RENDER_DEBUG);
+        m_gameRenderer->drawDebugInfo(m_player.get(), m_boss.get());
+    }
+    {
+        ScopedTimer uiTimer(m_profiler, ProfilePhase::RENDER_UI);
+        m_gameRenderer->drawUI(m_player.get(), m_boss.get(), m_sifAI.get());
+    }
+    {
+        ScopedTimer hudTimer(m_profiler, ProfilePhase::RENDER_HUD);
+        m_gameRenderer->drawPerfHUD(m_profiler, m_textureCache.get());
+    }
     
+    ScopedTimer presentTimer(m_profiler, ProfilePhase::RENDER_PRESENT);
     m_gameRenderer->present();
 }
 
+bool Game::loadAssetBundle() {
+    AssetBundle bundle;
+    if (m_bundlePath.empty() || !bundle.open(m_bundlePath)) {
+        return false;
+    }
+
+    const AssetBundle::Entry* sheet = bundle.find(PLAYER_SPRITE_SHEET);
+    std::vector<SpriteFrame> frames;
+    if (!sheet || sheet->kind != AssetBundle::Kind::IMAGE ||
+        sheet->frameWidth != Player::getFrameWidth() || sheet->frameHeight != Player::getFrameHeight() ||
+        !SpriteAtlas::readFrames(bundle.getMetrics(*sheet), sheet->metricsSize, sheet->width, sheet->height, frames)) {
+        std::cerr << "Asset bundle " << m_bundlePath << " is stale (rebake with --bake-bundle); decoding assets instead" << std::endl;
+        return false;
+    }
+
+    auto renderer = std::make_unique<Renderer>(m_renderer, m_width, m_height, nullptr, nullptr);
+    if (!renderer->loadGlyphAtlases(bundle)) {
+        std::cerr << "Asset bundle " << m_bundlePath << " has no usable glyph atlases; decoding assets instead" << std::endl;
+        return false;
+    }
+    m_gameRenderer = std::move(renderer);
+
+    // The bundle is unmapped on return; by then every texture has been uploaded
+    TextureHandle atlas = m_textureCache->insert(PLAYER_SPRITE_SHEET, bundle.getPixels(*sheet),
+                                                 sheet->width, sheet->height, sheet->pitch);
+    Player::setSpriteSheet(atlas, frames);
+
+    Trace::complete("LoadAssetBundle", "loading", m_loadStartCounter, SDL_GetPerformanceCounter());
+    return true;
+}
+
+bool Game::bakeAssetBundle(const std::string& path) {
+    // Decoding and rasterising need SDL_image and SDL_ttf, but no window or renderer
+    if (TTF_Init() == -1) {
+        std::cerr << "SDL_ttf could not initialize! SDL_ttf Error: " << TTF_GetError() << std::endl;
+        return false;
+    }
+    if (!(IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG)) {
+        std::cerr << "SDL_image could not initialize! SDL_image Error: " << IMG_GetError() << std::endl;
+        TTF_Quit();
+        return false;
+    }
+
+    AssetBundleWriter writer;
+    bool baked = false;
+
+    // The sheet goes in already packed; its frame table rides along as the entry's metrics
+    SDL_Surface* decoded = LTexture::decodeFile(PLAYER_SPRITE_SHEET);
+    std::vector<SpriteFrame> frames;
+    SDL_Surface* sheet = decoded ? SpriteAtlas::pack(decoded, Player::getFrameWidth(), Player::getFrameHeight(), frames) : nullptr;
+    if (sheet) {
+        std::vector<char> frameTable;
+        SpriteAtlas::writeFrames(frames, frameTable);
+        writer.addImage(PLAYER_SPRITE_SHEET, sheet, Player::getFrameWidth(), Player::getFrameHeight(), frameTable);
+        baked = Renderer::bakeGlyphAtlases(writer) && writer.write(path);
+    }
+    if (sheet) SDL_FreeSurface(sheet);
+    if (decoded) SDL_FreeSurface(decoded);
+
+    IMG_Quit();
+    TTF_Quit();
+
+    if (baked) {
+        std::cout << "Baked asset bundle " << path << std::endl;
+    } else {
+        std::cerr << "Failed to bake asset bundle " << path << std::endl;
+    }
+    return baked;
+}
+
+void Game::finishLoading() {
+    // The packed sheet is already in the cache, so this only takes a handle.
+    // Without it the game continues with rectangle rendering.
+    std::vector<SpriteFrame> frames;
+    TextureHandle atlas = m_textureCache->find(PLAYER_SPRITE_SHEET);
+    if (!atlas || !m_loader->takeFrames(PLAYER_SPRITE_SHEET, frames) || !Player::setSpriteSheet(atlas, frames)) {
+        std::cerr << "Warning: Failed to load player sprite, using fallback rendering" << std::endl;
+    }
+
+    // The font file was read on a worker; SDL_ttf only opens it here, on the main thread
+    std::vector<char> fontData;
+    m_loader->takeFontData(fontData);
+    m_gameRenderer = std::make_unique<Renderer>(m_renderer, m_width, m_height, std::move(fontData));
+    m_loader.reset();
+
+    Trace::complete("LoadAssets", "loading", m_loadStartCounter, SDL_GetPerformanceCounter());
+}
+
+void Game::renderLoadingScreen() {
+    SDL_SetRenderDrawColor(m_renderer, 20, 20, 30, 255);
+    SDL_RenderClear(m_renderer);
+
+    const int barWidth = 300;
+    const int barHeight = 12;
+    SDL_Rect frame = {(m_width - barWidth) / 2, m_height / 2, barWidth, barHeight};
+    SDL_Rect fill = {frame.x, frame.y, (int)(barWidth * m_loader->getProgress()), barHeight};
+
+    // A block sweeps back and forth above the bar so the screen visibly animates
+    const int sweepWidth = 40;
+    Uint32 period = 1200;
+    float phase = (SDL_GetTicks() % period) / (float)period;
+    float sweep = phase < 0.5f ? phase * 2.0f : 2.0f - phase * 2.0f;
+    SDL_Rect block = {frame.x + (int)(sweep * (barWidth - sweepWidth)), frame.y - 20, sweepWidth, 6};
+
+    SDL_SetRenderDrawColor(m_renderer, 200, 170, 90, 255);
+    SDL_RenderFillRect(m_renderer, &fill);
+    SDL_RenderFillRect(m_renderer, &block);
+    SDL_SetRenderDrawColor(m_renderer, 255, 255, 255, 255);
+    SDL_RenderDrawRect(m_renderer, &frame);
+    SDL_RenderPresent(m_renderer);
+}
+
+void Game::setTextureBudget(size_t bytes) {
+    m_textureBudget = bytes;
+    if (m_textureCache) {
+        m_textureCache->setBudget(bytes);
+    }
+}
+
 void Game::clean() {
-    // Clean up player textures
-    Player::freeTexture();
-    
     // Clean up AI
     m_sifAI.reset();
+
+    if (m_headless) {
+        return;  // Nothing of SDL was initialized
+    }
+
+    // Stop any loading still in flight, then release texture handles and the
+    // textures themselves while the SDL renderer still exists
+    m_loader.reset();
+    Player::freeTexture();
+    if (m_textureCache) {
+        m_textureCache->printReport(std::cout);
+        m_textureCache.reset();
+    }
+
+    // Release the renderer's textures while the SDL renderer still exists
+    m_gameRenderer.reset();
     
     if (m_renderer) {
         SDL_DestroyRenderer(m_renderer);
@@ -3,39 +3,124 @@
 
 #include <SDL2/SDL.h>
 #include <memory>
+#include <string>
+#include "InputHandler.h"
+#include "Profiler.h"
+#include "EntityStore.h"
+#include "ProjectilePool.h"
+#include "SpatialHash.h"
+#include <vector>
 
 class Player;
 class Boss;
 class Renderer;
-class InputHandler;
 class HolySwordWolfAI;
+class InputRecording;
+class TextureCache;
+class AssetLoader;
+struct Circle;
+struct SwordArc;
+
+// Collision helpers used by the fixed update (also exercised by the benchmarks)
+bool checkCollision(const SDL_Rect& a, const SDL_Rect& b);
+bool checkCollision(const Circle& a, const SDL_Rect& b);
+bool checkCollision(const SwordArc& a, const SDL_Rect& b);
+// Swept AABB: a started the tick there, then moved (dx, dy) pixels relative to b. True if they
+// overlapped at any point of the move; timeOfImpact is the fraction of it at first contact.
+bool sweepCollision(const SDL_Rect& a, float dx, float dy, const SDL_Rect& b, float& timeOfImpact);
+void separateEntities(Vector2D& pos1, Vector2D& pos2, float radius1, float radius2);
 
 class Game {
 private:
     bool m_isRunning;
+    bool m_headless;  // Simulation only: no window, renderer, input or assets
+    int m_width;
+    int m_height;
+    unsigned int m_seed;  // AI RNG seed for the current fight
     SDL_Window* m_window;
     SDL_Renderer* m_renderer;
     
+    EntityStore m_entities;  // Component state of every combatant; outlives the views below
     std::unique_ptr<Player> m_player;
     std::unique_ptr<Boss> m_boss;
+    ProjectilePool m_projectiles;  // Every shot in flight, from either side
+    SpatialHash m_collisionGrid;   // Broad phase, rebuilt every tick
+    std::vector<int> m_hitCandidates;  // Reused query results
     std::unique_ptr<HolySwordWolfAI> m_sifAI;  // Added Sif AI
     std::unique_ptr<Renderer> m_gameRenderer;
     std::unique_ptr<InputHandler> m_inputHandler;
+    std::unique_ptr<TextureCache> m_textureCache;
+    size_t m_textureBudget;  // Texture memory the cache aims to stay under, in bytes
+    std::unique_ptr<AssetLoader> m_loader;  // Set while assets load in the background
+    std::string m_bundlePath;  // Pre-decoded assets; when missing or stale, assets are decoded instead
     
     Uint32 m_lastTime;
+    Uint64 m_loadStartCounter;  // Performance counter when asset loading began, for the trace
+
+    // Phase timings for interactive runs (left disabled when headless)
+    Profiler m_profiler;
+
+    // Input latched by handleEvents until the next fixed tick consumes it
+    PlayerInput m_pendingInput;
+    long long m_tick;  // Ticks simulated in the current fight
+
+    // Recording appends every tick's input; replay substitutes recorded input for live input
+    std::unique_ptr<InputRecording> m_recording;
+    std::unique_ptr<InputRecording> m_replay;
+
+    void applyPlayerInput(const PlayerInput& input);
+    void createFight();
+    void fireBossProjectiles();
+    void rebuildCollisionGrid();
+    bool loadAssetBundle();
+    void finishLoading();
+    void renderLoadingScreen();
     
 public:
     Game();
     ~Game();
     
     bool init(const char* title, int width, int height);
+    bool initHeadless(int width, int height, unsigned int seed);
     void handleEvents();
-    void update(float deltaTime);
+    void update(float deltaTime);  // Advances the simulation by one fixed tick
     void render();
     void clean();
     
+    void setTextureBudget(size_t bytes);  // Applies immediately if the cache already exists
+    void setAssetBundle(const std::string& path) { m_bundlePath = path; }  // Before init; empty disables
+
+    // Offline step: decodes the sprite sheet and rasterises the glyph atlases into one bundle file
+    static bool bakeAssetBundle(const std::string& path);
+
     bool isRunning() const { return m_isRunning; }
+    bool isHeadless() const { return m_headless; }
     void quit() { m_isRunning = false; }
+
+    // Drive the player directly (headless runs have no InputHandler)
+    void setPlayerInput(const PlayerInput& input) { m_pendingInput = input; }
+    bool isFightOver() const;
+    void resetFight(unsigned int seed);
+
+    const Player* getPlayer() const { return m_player.get(); }
+    const Boss* getBoss() const { return m_boss.get(); }
+    const HolySwordWolfAI* getAI() const { return m_sifAI.get(); }
+    const ProjectilePool& getProjectiles() const { return m_projectiles; }
+    unsigned int getSeed() const { return m_seed; }
+    long long getTick() const { return m_tick; }
+
+    Profiler& getProfiler() { return m_profiler; }
+    const Profiler& getProfiler() const { return m_profiler; }
+
+    // Input recording and replay; both restart the fight so the log covers it from tick 0
+    void startRecording(float fixedStep);
+    const InputRecording* getRecording() const { return m_recording.get(); }
+    void startReplay(const InputRecording& recording);
+    bool isReplaying() const { return m_replay != nullptr; }
+    bool isReplayFinished() const;
+
+    // Hash of the simulation state, for checking that a replay matched its recording
+    Uint32 getStateChecksum() const;
 };
 
 #endif
@@ -0,0 +1,223 @@
+#include "GlyphAtlas.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+GlyphAtlas::GlyphAtlas() : m_texture(nullptr), m_width(0), m_height(0), m_lineSkip(0) {
+    std::fill(&m_kerning[0][0], &m_kerning[0][0] + GLYPH_COUNT * GLYPH_COUNT, 0);
+    for (Glyph& glyph : m_glyphs) {
+        glyph = Glyph{{0, 0, 0, 0}, 0, 0};
+    }
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    free();
+}
+
+void GlyphAtlas::free() {
+    if (m_texture) {
+        SDL_DestroyTexture(m_texture);
+        m_texture = nullptr;
+    }
+}
+
+int GlyphAtlas::glyphIndex(char c) {
+    unsigned char code = (unsigned char)c;
+    if (code < FIRST_CHAR || code > LAST_CHAR) code = '?';
+    return code - FIRST_CHAR;
+}
+
+bool GlyphAtlas::build(SDL_Renderer* renderer, TTF_Font* font) {
+    free();
+    if (!renderer || !font) return false;
+
+    SDL_Surface* atlas = rasterize(font);
+    if (!atlas) {
+        std::cerr << "Unable to build glyph atlas: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    bool uploaded = upload(renderer, atlas->pixels, atlas->pitch);
+    SDL_FreeSurface(atlas);
+    return uploaded;
+}
+
+SDL_Surface* GlyphAtlas::rasterize(TTF_Font* font) {
+    if (!font) return nullptr;
+
+    // Render every glyph white; vertex colours tint them at draw time
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface* cells[GLYPH_COUNT] = {};
+    int penX = 0;
+    int penY = 0;
+    int rowHeight = 0;
+
+    for (int i = 0; i < GLYPH_COUNT; ++i) {
+        Uint16 code = (Uint16)(FIRST_CHAR + i);
+        int minX = 0, maxX = 0, minY = 0, maxY = 0, advance = 0;
+        if (TTF_GlyphMetrics(font, code, &minX, &maxX, &minY, &maxY, &advance) != 0) {
+            advance = 0;
+        }
+
+        Glyph& glyph = m_glyphs[i];
+        glyph.advance = advance;
+        glyph.offsetX = std::min(0, minX);
+
+        cells[i] = TTF_RenderGlyph_Blended(font, code, white);
+        if (!cells[i]) continue;
+
+        // Shelf packing: fill a row left to right, then start the next one
+        if (penX + cells[i]->w > ATLAS_WIDTH) {
+            penX = 0;
+            penY += rowHeight + 1;
+            rowHeight = 0;
+        }
+        glyph.source = {penX, penY, cells[i]->w, cells[i]->h};
+        penX += cells[i]->w + 1;
+        rowHeight = std::max(rowHeight, cells[i]->h);
+    }
+
+    m_width = ATLAS_WIDTH;
+    m_height = std::max(1, penY + rowHeight);
+    m_lineSkip = TTF_FontLineSkip(font);
+
+    SDL_Surface* atlas = SDL_CreateRGBSurfaceWithFormat(0, m_width, m_height, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (atlas) {
+        for (int i = 0; i < GLYPH_COUNT; ++i) {
+            if (!cells[i]) continue;
+            SDL_SetSurfaceBlendMode(cells[i], SDL_BLENDMODE_NONE);  // Copy alpha as-is
+            SDL_Rect dest = m_glyphs[i].source;
+            SDL_BlitSurface(cells[i], nullptr, atlas, &dest);
+        }
+    }
+
+    for (SDL_Surface* cell : cells) {
+        if (cell) SDL_FreeSurface(cell);
+    }
+
+    for (int previous = 0; previous < GLYPH_COUNT; ++previous) {
+        for (int current = 0; current < GLYPH_COUNT; ++current) {
+            int kerning = TTF_GetFontKerningSizeGlyphs(font, (Uint16)(FIRST_CHAR + previous),
+                                                       (Uint16)(FIRST_CHAR + current));
+            m_kerning[previous][current] = (signed char)std::max(-128, std::min(127, kerning));
+        }
+    }
+
+    return atlas;
+}
+
+bool GlyphAtlas::upload(SDL_Renderer* renderer, const void* pixels, int pitch) {
+    free();
+    if (!renderer || !pixels || m_width <= 0 || m_height <= 0) return false;
+
+    m_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, m_width, m_height);
+    if (!m_texture || SDL_UpdateTexture(m_texture, nullptr, pixels, pitch) != 0) {
+        std::cerr << "Unable to upload glyph atlas: " << SDL_GetError() << std::endl;
+        free();
+        return false;
+    }
+    SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+    return true;
+}
+
+void GlyphAtlas::writeMetrics(std::vector<char>& out) const {
+    const Sint32 header[3] = {m_width, m_height, m_lineSkip};
+    const char* parts[3] = {reinterpret_cast<const char*>(header), reinterpret_cast<const char*>(m_glyphs),
+                            reinterpret_cast<const char*>(m_kerning)};
+    const size_t sizes[3] = {sizeof(header), sizeof(m_glyphs), sizeof(m_kerning)};
+    for (int i = 0; i < 3; ++i) {
+        out.insert(out.end(), parts[i], parts[i] + sizes[i]);
+    }
+}
+
+bool GlyphAtlas::readMetrics(const void* data, size_t size, int atlasWidth, int atlasHeight) {
+    Sint32 header[3];
+    if (size != sizeof(header) + sizeof(m_glyphs) + sizeof(m_kerning)) return false;
+
+    // The texture is sized from the header and filled from the bundle's pixels, so they must agree
+    const char* bytes = static_cast<const char*>(data);
+    std::memcpy(header, bytes, sizeof(header));
+    if (header[0] != atlasWidth || header[1] != atlasHeight) return false;
+
+    Glyph glyphs[GLYPH_COUNT];
+    std::memcpy(glyphs, bytes + sizeof(header), sizeof(glyphs));
+    for (const Glyph& glyph : glyphs) {
+        const SDL_Rect& r = glyph.source;
+        if (r.x < 0 || r.y < 0 || r.w < 0 || r.h < 0 ||
+            (long long)r.x + r.w > atlasWidth || (long long)r.y + r.h > atlasHeight) {
+            return false;
+        }
+    }
+
+    std::memcpy(m_glyphs, glyphs, sizeof(m_glyphs));
+    std::memcpy(m_kerning, bytes + sizeof(header) + sizeof(m_glyphs), sizeof(m_kerning));
+    m_width = header[0];
+    m_height = header[1];
+    m_lineSkip = header[2];
+    return true;
+}
+
+void GlyphAtlas::drawText(SDL_Renderer* renderer, const std::string& text, int x, int y, SDL_Color color) {
+    if (!m_texture) return;
+
+    // Worst case is one quad per character; the buffers only ever grow
+    if (m_vertices.size() < text.size() * 4) {
+        m_vertices.resize(text.size() * 4);
+        m_indices.resize(text.size() * 6);
+    }
+    SDL_Vertex* vertex = m_vertices.data();
+    int* index = m_indices.data();
+
+    const float inverseWidth = 1.0f / m_width;
+    const float inverseHeight = 1.0f / m_height;
+    int penX = x;
+    int penY = y;
+    int previous = -1;
+    int quadCount = 0;
+
+    for (char c : text) {
+        if (c == '\n') {
+            penX = x;
+            penY += m_lineSkip;
+            previous = -1;
+            continue;
+        }
+
+        int current = glyphIndex(c);
+        const Glyph& glyph = m_glyphs[current];
+        if (previous >= 0) penX += m_kerning[previous][current];
+        previous = current;
+
+        if (c != ' ' && glyph.source.w > 0) {
+            float left = (float)(penX + glyph.offsetX);
+            float top = (float)penY;
+            float right = left + glyph.source.w;
+            float bottom = top + glyph.source.h;
+            float u0 = glyph.source.x * inverseWidth;
+            float v0 = glyph.source.y * inverseHeight;
+            float u1 = (glyph.source.x + glyph.source.w) * inverseWidth;
+            float v1 = (glyph.source.y + glyph.source.h) * inverseHeight;
+
+            vertex[0] = SDL_Vertex{{left, top}, color, {u0, v0}};
+            vertex[1] = SDL_Vertex{{right, top}, color, {u1, v0}};
+            vertex[2] = SDL_Vertex{{right, bottom}, color, {u1, v1}};
+            vertex[3] = SDL_Vertex{{left, bottom}, color, {u0, v1}};
+            vertex += 4;
+
+            int base = quadCount * 4;
+            index[0] = base;
+            index[1] = base + 1;
+            index[2] = base + 2;
+            index[3] = base;
+            index[4] = base + 2;
+            index[5] = base + 3;
+            index += 6;
+            ++quadCount;
+        }
+
+        penX += glyph.advance;
+    }
+
+    if (quadCount > 0) {
+        SDL_RenderGeometry(renderer, m_texture, m_vertices.data(), quadCount * 4, m_indices.data(), quadCount * 6);
+    }
+}
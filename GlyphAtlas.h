@@ -0,0 +1,66 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <string>
+#include <vector>
+
+// Printable ASCII for one font and size, rendered once into a single texture
+// with cached advances and kerning. A string is drawn as one batch of
+// textured quads instead of a TTF render and texture upload per call.
+class GlyphAtlas {
+public:
+    GlyphAtlas();
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    bool build(SDL_Renderer* renderer, TTF_Font* font);
+    void free();
+    bool isReady() const { return m_texture != nullptr; }
+
+    // Offline half of build(): lays out the glyphs and returns the ARGB8888
+    // atlas pixels, or null. Needs no renderer; the caller frees the surface.
+    SDL_Surface* rasterize(TTF_Font* font);
+    // Creates the texture from atlas pixels matching the current metrics
+    bool upload(SDL_Renderer* renderer, const void* pixels, int pitch);
+
+    // Layout, advances and kerning as a flat blob, for baking into an asset bundle.
+    // readMetrics rejects a blob whose size differs from the atlas pixels it
+    // comes with, or whose glyph cells fall outside them.
+    void writeMetrics(std::vector<char>& out) const;
+    bool readMetrics(const void* data, size_t size, int atlasWidth, int atlasHeight);
+
+    // Draws text with its top-left at (x, y); '\n' starts a new line
+    void drawText(SDL_Renderer* renderer, const std::string& text, int x, int y, SDL_Color color);
+    int getLineSkip() const { return m_lineSkip; }
+
+private:
+    static const int FIRST_CHAR = 32;
+    static const int LAST_CHAR = 126;
+    static const int GLYPH_COUNT = LAST_CHAR - FIRST_CHAR + 1;
+    static const int ATLAS_WIDTH = 512;
+
+    struct Glyph {
+        SDL_Rect source;   // Cell in the atlas, full font height
+        int offsetX;       // Cell origin relative to the pen (negative for glyphs that overhang left)
+        int advance;
+    };
+
+    static int glyphIndex(char c);
+
+    SDL_Texture* m_texture;
+    int m_width;
+    int m_height;
+    int m_lineSkip;
+    Glyph m_glyphs[GLYPH_COUNT];
+    signed char m_kerning[GLYPH_COUNT][GLYPH_COUNT];   // [previous][current]
+
+    // Reused between calls so drawing does not allocate
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;
+};
+
+#endif
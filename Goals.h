@@ -1,6 +1,9 @@
 #ifndef GOALS_H
 #define GOALS_H
 
+#include <SDL2/SDL.h>
+#include "Vector2D.h"
+
 class HolySwordWolfAI;
 
 // Attack types based on the Lua scripts
@@ -48,6 +51,7 @@ public:
     virtual GoalType getType() const = 0;
     
     float lifeTime = -1.0f; // -1 means infinite
+    Uint64 traceId = 0;     // Links activate/terminate in trace output
 };
 
 // Specific goal implementations
@@ -72,6 +76,7 @@ class MoveToTargetGoal : public AIGoal {
 private:
     float targetDistance;
     bool walk;
+    Vector2D lastTargetPos;  // Target position the current path was planned against
     
 public:
     MoveToTargetGoal(float dist, bool shouldWalk = false) 
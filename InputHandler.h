@@ -4,6 +4,14 @@
 #include <SDL2/SDL.h>
 #include "Vector2D.h"
 
+// Player commands consumed by one simulation tick
+struct PlayerInput {
+    Vector2D moveDir;
+    bool attack = false;
+    bool dodge = false;
+    bool toggleEnhanced = false;  // Ctrl+E debug command; goes through the tick so replays match
+};
+
 class InputHandler {
     const Uint8* m_keyStates;
 
@@ -0,0 +1,137 @@
+#include "InputRecording.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+    const char FILE_MAGIC[4] = {'B', 'F', 'R', 'P'};
+
+    // Packed input bits
+    const Uint8 MOVE_RIGHT = 1 << 0;
+    const Uint8 MOVE_LEFT = 1 << 1;
+    const Uint8 MOVE_DOWN = 1 << 2;
+    const Uint8 MOVE_UP = 1 << 3;
+    const Uint8 PRESS_ATTACK = 1 << 4;
+    const Uint8 PRESS_DODGE = 1 << 5;
+    const Uint8 TOGGLE_ENHANCED = 1 << 6;
+
+    void writeU32(std::ostream& out, Uint32 value) {
+        char bytes[4] = {(char)(value & 0xFF), (char)((value >> 8) & 0xFF),
+                         (char)((value >> 16) & 0xFF), (char)((value >> 24) & 0xFF)};
+        out.write(bytes, 4);
+    }
+
+    bool readU32(std::istream& in, Uint32& value) {
+        unsigned char bytes[4];
+        if (!in.read((char*)bytes, 4)) return false;
+        value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((Uint32)bytes[3] << 24);
+        return true;
+    }
+}
+
+InputRecording::InputRecording() : m_seed(0), m_fixedStep(0.0f) {}
+
+InputRecording::InputRecording(unsigned int seed, float fixedStep)
+    : m_seed(seed), m_fixedStep(fixedStep) {}
+
+void InputRecording::record(const PlayerInput& input) {
+    m_ticks.push_back(pack(input));
+}
+
+Uint8 InputRecording::pack(const PlayerInput& input) {
+    Uint8 packed = 0;
+    if (input.moveDir.x > 0) packed |= MOVE_RIGHT;
+    if (input.moveDir.x < 0) packed |= MOVE_LEFT;
+    if (input.moveDir.y > 0) packed |= MOVE_DOWN;
+    if (input.moveDir.y < 0) packed |= MOVE_UP;
+    if (input.attack) packed |= PRESS_ATTACK;
+    if (input.dodge) packed |= PRESS_DODGE;
+    if (input.toggleEnhanced) packed |= TOGGLE_ENHANCED;
+    return packed;
+}
+
+PlayerInput InputRecording::unpack(Uint8 packed) {
+    // Rebuild the direction the same way InputHandler::getMovementDirection does
+    Vector2D direction(0, 0);
+    if (packed & MOVE_UP) direction.y -= 1;
+    if (packed & MOVE_DOWN) direction.y += 1;
+    if (packed & MOVE_LEFT) direction.x -= 1;
+    if (packed & MOVE_RIGHT) direction.x += 1;
+
+    PlayerInput input;
+    input.moveDir = direction.normalized();
+    input.attack = (packed & PRESS_ATTACK) != 0;
+    input.dodge = (packed & PRESS_DODGE) != 0;
+    input.toggleEnhanced = (packed & TOGGLE_ENHANCED) != 0;
+    return input;
+}
+
+bool InputRecording::saveToFile(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        std::cerr << "Unable to open recording for writing: " << path << std::endl;
+        return false;
+    }
+
+    Uint32 stepBits;
+    std::memcpy(&stepBits, &m_fixedStep, sizeof(stepBits));
+
+    out.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    writeU32(out, FILE_VERSION);
+    writeU32(out, m_seed);
+    writeU32(out, stepBits);
+    writeU32(out, (Uint32)m_ticks.size());
+
+    // Run-length encode: held keys make long runs of identical ticks
+    size_t i = 0;
+    while (i < m_ticks.size()) {
+        Uint8 value = m_ticks[i];
+        Uint16 run = 1;
+        while (i + run < m_ticks.size() && m_ticks[i + run] == value && run < 0xFFFF) {
+            ++run;
+        }
+        char bytes[3] = {(char)value, (char)(run & 0xFF), (char)(run >> 8)};
+        out.write(bytes, 3);
+        i += run;
+    }
+
+    return (bool)out;
+}
+
+bool InputRecording::loadFromFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::cerr << "Unable to open recording: " << path << std::endl;
+        return false;
+    }
+
+    char magic[4];
+    Uint32 version, seed, stepBits, tickCount;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0 ||
+        !readU32(in, version) || !readU32(in, seed) || !readU32(in, stepBits) || !readU32(in, tickCount)) {
+        std::cerr << "Not a valid input recording: " << path << std::endl;
+        return false;
+    }
+    if (version != FILE_VERSION) {
+        std::cerr << "Recording " << path << " is version " << version << ", this build replays version "
+                  << FILE_VERSION << std::endl;
+        return false;
+    }
+
+    m_seed = seed;
+    std::memcpy(&m_fixedStep, &stepBits, sizeof(m_fixedStep));
+    m_ticks.clear();
+    m_ticks.reserve(tickCount);
+
+    unsigned char bytes[3];
+    while (m_ticks.size() < tickCount && in.read((char*)bytes, 3)) {
+        Uint16 run = bytes[1] | (bytes[2] << 8);
+        m_ticks.insert(m_ticks.end(), run, bytes[0]);
+    }
+
+    if (m_ticks.size() != tickCount) {
+        std::cerr << "Truncated input recording: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,49 @@
+#ifndef INPUTRECORDING_H
+#define INPUTRECORDING_H
+
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+#include "InputHandler.h"
+
+// Per-tick player input plus the AI seed and tick length of one fight.
+// Together with the fixed-step simulation this reproduces the fight exactly.
+//
+// File layout (little-endian):
+//   "BFRP"  u32 version  u32 seed  u32 fixedStep (float bits)  u32 tickCount
+//   then runs of (u8 packed input, u16 run length) until tickCount is covered
+class InputRecording {
+public:
+    InputRecording();
+    InputRecording(unsigned int seed, float fixedStep);
+
+    void record(const PlayerInput& input);
+    PlayerInput getInput(size_t tick) const { return unpack(m_ticks[tick]); }
+    size_t getTickCount() const { return m_ticks.size(); }
+
+    unsigned int getSeed() const { return m_seed; }
+    float getFixedStep() const { return m_fixedStep; }
+
+    bool saveToFile(const std::string& path) const;
+    bool loadFromFile(const std::string& path);
+
+    // Inputs are keyboard-shaped: each move axis is -1, 0 or +1 before normalizing
+    static Uint8 pack(const PlayerInput& input);
+    static PlayerInput unpack(Uint8 packed);
+
+private:
+    unsigned int m_seed;
+    float m_fixedStep;
+    std::vector<Uint8> m_ticks;
+
+    // Bump whenever the simulation changes what a recorded fight plays out as, so
+    // old recordings are refused instead of replaying into a different fight.
+    // 2: baked sword curves.
+    // 3: store-side integration.
+    // 4: boss projectile attack.
+    // 5: swept body and hitbox collision.
+    // 6: boss blade tested over its swept arc.
+    static const Uint32 FILE_VERSION = 6;
+};
+
+#endif
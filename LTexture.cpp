@@ -1,4 +1,5 @@
 #include "LTexture.h"
+#include "FrameCounters.h"
 #include <stdio.h>
 #include <iostream>
 
@@ -25,36 +26,68 @@ bool LTexture::loadFromFile(std::string path) {
     // Get rid of preexisting texture
     free();
 
-    // The final texture
-    SDL_Texture* newTexture = NULL;
+    SDL_Surface* loadedSurface = decodeFile(path);
+    if (loadedSurface == NULL) {
+        return false;
+    }
+
+    bool success = loadFromSurface(loadedSurface);
+    if (!success) {
+        printf("Unable to create texture from %s! SDL Error: %s\n", path.c_str(), SDL_GetError());
+    }
+
+    // Get rid of old loaded surface
+    SDL_FreeSurface(loadedSurface);
+    return success;
+}
 
+SDL_Surface* LTexture::decodeFile(const std::string& path) {
     // Load image at specified path
     SDL_Surface* loadedSurface = IMG_Load(path.c_str());
     if (loadedSurface == NULL) {
         printf("Unable to load image %s! SDL_image Error: %s\n", path.c_str(), IMG_GetError());
-    } else {
-        // Color key image (make cyan transparent)
-        SDL_SetColorKey(loadedSurface, SDL_TRUE, SDL_MapRGB(loadedSurface->format, 0, 0xFF, 0xFF));
-
-        // Create texture from surface pixels
-        newTexture = SDL_CreateTextureFromSurface(s_Renderer, loadedSurface);
-        if (newTexture == NULL) {
-            printf("Unable to create texture from %s! SDL Error: %s\n", path.c_str(), SDL_GetError());
-        } else {
-            // Get image dimensions
-            mWidth = loadedSurface->w;
-            mHeight = loadedSurface->h;
-        }
-
-        // Get rid of old loaded surface
-        SDL_FreeSurface(loadedSurface);
+        return NULL;
     }
 
-    // Return success
-    mTexture = newTexture;
+    // Color key image (make cyan transparent)
+    SDL_SetColorKey(loadedSurface, SDL_TRUE, SDL_MapRGB(loadedSurface->format, 0, 0xFF, 0xFF));
+    return loadedSurface;
+}
+
+bool LTexture::loadFromSurface(SDL_Surface* surface) {
+    // Get rid of preexisting texture
+    free();
+
+    // Create texture from surface pixels
+    mTexture = SDL_CreateTextureFromSurface(s_Renderer, surface);
+    if (mTexture != NULL) {
+        // Get image dimensions
+        mWidth = surface->w;
+        mHeight = surface->h;
+    }
     return mTexture != NULL;
 }
 
+bool LTexture::loadFromPixels(const void* pixels, int width, int height, int pitch) {
+    // Get rid of preexisting texture
+    free();
+
+    mTexture = SDL_CreateTexture(s_Renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, width, height);
+    if (mTexture == NULL) {
+        return false;
+    }
+    if (SDL_UpdateTexture(mTexture, NULL, pixels, pitch) != 0) {
+        free();
+        return false;
+    }
+
+    // Colour-keyed pixels arrive as alpha, so blend like a colour-keyed surface would
+    SDL_SetTextureBlendMode(mTexture, SDL_BLENDMODE_BLEND);
+    mWidth = width;
+    mHeight = height;
+    return true;
+}
+
 void LTexture::free() {
     // Free texture if it exists
     if (mTexture != NULL) {
@@ -92,12 +125,13 @@ void LTexture::render(int x, int y, SDL_Rect* clip) {
 
     // Render to screen
     SDL_RenderCopy(s_Renderer, mTexture, clip, &renderQuad);
+    FrameCounters::addDrawCalls();
 }
 
-int LTexture::getWidth() {
+int LTexture::getWidth() const {
     return mWidth;
 }
 
-int LTexture::getHeight() {
+int LTexture::getHeight() const {
     return mHeight;
 }
@@ -13,9 +13,23 @@ public:
     // Deallocates memory
     ~LTexture();
 
+    // Owns an SDL texture, so it is shared through handles rather than copied
+    LTexture(const LTexture&) = delete;
+    LTexture& operator=(const LTexture&) = delete;
+
     // Loads image at specified path
     bool loadFromFile(std::string path);
 
+    // Decodes and colour keys an image without touching the renderer, so it
+    // may run on any thread. The caller frees the surface.
+    static SDL_Surface* decodeFile(const std::string& path);
+
+    // Uploads a decoded surface (render thread only); the surface is not freed
+    bool loadFromSurface(SDL_Surface* surface);
+
+    // Uploads ARGB8888 pixels straight into a static texture, with no intermediate surface
+    bool loadFromPixels(const void* pixels, int width, int height, int pitch);
+
     // Deallocates texture
     void free();
 
@@ -32,8 +46,11 @@ public:
     void render(int x, int y, SDL_Rect* clip = NULL);
 
     // Gets image dimensions
-    int getWidth();
-    int getHeight();
+    int getWidth() const;
+    int getHeight() const;
+
+    // Approximate video memory used, assuming 32 bits per texel
+    size_t getBytes() const { return (size_t)mWidth * mHeight * 4; }
     SDL_Texture* getTexture() const { return mTexture; };
 
     // Set the global renderer (call this once during initialization)
@@ -1,5 +1,6 @@
 #include "Player.h"
 #include "GameUnits.h"
+#include "Renderer.h"
 #include <cmath>
 #include <algorithm>
 #include <iostream>
@@ -9,12 +10,53 @@
 #endif
 
 // Static member definitions
-LTexture Player::s_playerSpriteSheet;
-bool Player::s_textureLoaded = false;
+TextureHandle Player::s_playerSpriteSheet;
+std::vector<SpriteFrame> Player::s_spriteFrames;
+
+// Sheet layout: [Animation_Row][Direction_Column * FRAMES_PER_ANIMATION + Frame]
+constexpr Player::AnimationClip Player::makeClip(AnimationType anim, float frameDuration, bool loops) {
+    const int row = static_cast<int>(anim);
+    AnimationClip clip = {};
+    clip.anim = anim;
+    clip.frameCount = FRAMES_PER_ANIMATION;
+    clip.loops = loops;
+    for (int frame = 0; frame < FRAMES_PER_ANIMATION; ++frame) {
+        clip.frameDurations[frame] = frameDuration;
+        for (int direction = 0; direction < DIRECTIONS_PER_ANIMATION; ++direction) {
+            clip.cells[direction][frame] = (row * DIRECTIONS_PER_ANIMATION + direction) * FRAMES_PER_ANIMATION + frame;
+        }
+    }
+    return clip;
+}
+
+constexpr Player::AnimationClip Player::s_clips[Player::TOTAL_ANIMATIONS] = {
+    makeClip(AnimationType::SWORD_IDLE, 0.2f, true),       // Normal speed
+    makeClip(AnimationType::SWORD_RUN, 0.2f, true),
+    makeClip(AnimationType::DASH, 0.08f, false),           // Very fast dash
+    makeClip(AnimationType::TAKE_DAMAGE, 0.05f, false),
+    makeClip(AnimationType::DEATH, 0.15f, false),          // Slower for impact
+    makeClip(AnimationType::SWORD_ATTACK1, 0.05f, false),  // Fast attack animations
+    makeClip(AnimationType::SWORD_ATTACK2, 0.05f, false),
+};
+
+// The table is positional, so check every row rather than trusting the order
+constexpr bool Player::clipsMatchLayout() {
+    for (int index = 0; index < TOTAL_ANIMATIONS; ++index) {
+        const AnimationClip& clip = s_clips[index];
+        if (static_cast<int>(clip.anim) != index || clip.frameCount != FRAMES_PER_ANIMATION) return false;
+        for (int direction = 0; direction < DIRECTIONS_PER_ANIMATION; ++direction) {
+            for (int frame = 0; frame < FRAMES_PER_ANIMATION; ++frame) {
+                if (clip.cells[direction][frame] != (index * DIRECTIONS_PER_ANIMATION + direction) * FRAMES_PER_ANIMATION + frame) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
 
-Player::Player(float x, float y)
-    : Entity(x, y, 30, 50, 100),  // postion, width, height, health
-      m_state(PlayerState::IDLE),
+Player::Player(EntityStore& store, float x, float y)
+    : Entity(store, x, y, 30, 50, 100),  // postion, width, height, health
       m_direction(PlayerDirection::DOWN),
       m_currentWeapon(WeaponType::SWORD),
       m_currentAnimation(AnimationType::SWORD_IDLE),
@@ -38,20 +80,15 @@ Player::Player(float x, float y)
       m_dodgeDirection(0, -1),
       m_stateTimer(0.0f),
       m_animationTimer(0.0f),
-      m_windowWidth(GameUnits::toMeters(800.0f)),
-      m_windowHeight(GameUnits::toMeters(600.0f)),
       m_frameIndex(0),
-      m_frameTime(0.2f),  // 200ms per frame
       m_frameTimer(0.0f),
       m_animationComplete(true) {
 
+    setState(PlayerState::IDLE);
+    setWindowBounds(800.0f, 600.0f);
+
     // Initialize first frame (idle, facing down)
-    m_currentFrame = {
-        0,  // x position in sprite sheet
-        0,  // y position in sprite sheet  
-        FRAME_WIDTH,
-        FRAME_HEIGHT
-    };
+    m_currentFrame = 0;
 
     updateSwordPosition();
 }
@@ -61,43 +98,24 @@ Player::~Player() {
     // Destructor - static texture is cleaned up separately
 }
 
-bool Player::loadTexture(SDL_Renderer* renderer, const std::string& path) {
-    if (s_textureLoaded) {
-        return true;  // Already loaded
+bool Player::setSpriteSheet(const TextureHandle& atlas, const std::vector<SpriteFrame>& frames) {
+    // Cells are laid out [Animation_Row][Direction_Column * FRAMES_PER_ANIMATION + Frame]
+    size_t expectedFrames = (size_t)FRAMES_PER_ANIMATION * DIRECTIONS_PER_ANIMATION * TOTAL_ANIMATIONS;
+    if (!atlas || frames.size() != expectedFrames) {
+        std::cerr << "WARNING: Player sprite sheet has " << frames.size() << " frames, expected "
+                  << expectedFrames << "; using fallback rendering" << std::endl;
+        freeTexture();
+        return false;
     }
-    
-    bool success = s_playerSpriteSheet.loadFromFile(path);
-    if (success) {
-        s_textureLoaded = true;
-        
-        // Debug: Check sprite sheet dimensions
-        int width = s_playerSpriteSheet.getWidth();
-        int height = s_playerSpriteSheet.getHeight();
-        int expectedWidth = FRAME_WIDTH * FRAMES_PER_ANIMATION * DIRECTIONS_PER_ANIMATION; // 128 * 6 * 4 = 3072
-        int expectedHeight = FRAME_HEIGHT * 7; // 128 * 7 = 896
-        
-        std::cout << "Player sprite sheet loaded: " << path << std::endl;
-        std::cout << "  Actual dimensions: " << width << "x" << height << std::endl;
-        std::cout << "  Expected dimensions: " << expectedWidth << "x" << expectedHeight << std::endl;
-        
-        if (width != expectedWidth || height != expectedHeight) {
-            std::cerr << "WARNING: Sprite sheet dimensions don't match expected layout!" << std::endl;
-            std::cerr << "  This may cause rendering issues or crashes." << std::endl;
-        } else {
-            std::cout << "  Sprite sheet dimensions are correct!" << std::endl;
-        }
-        
-    } else {
-        std::cerr << "Failed to load player sprite sheet: " << path << std::endl;
-    }
-    return success;
+
+    s_playerSpriteSheet = atlas;
+    s_spriteFrames = frames;
+    return true;
 }
 
 void Player::freeTexture() {
-    if (s_textureLoaded) {
-        s_playerSpriteSheet.free();
-        s_textureLoaded = false;
-    }
+    s_playerSpriteSheet.reset();
+    s_spriteFrames.clear();
 }
 
 void Player::setAnimation(AnimationType animation) {
@@ -106,96 +124,31 @@ void Player::setAnimation(AnimationType animation) {
         m_frameIndex = 0;
         m_frameTimer = 0.0f;
         m_animationComplete = false;
-        
-        // Set frame time based on animation type
-        switch (animation) {
-            case AnimationType::SWORD_ATTACK1:
-            case AnimationType::SWORD_ATTACK2:
-                m_frameTime = 0.05f;  // Fast attack animations
-                break;
-            case AnimationType::DASH:
-                m_frameTime = 0.08f;  // Very fast dash
-                break;
-            case AnimationType::TAKE_DAMAGE:
-                m_frameTime = 0.05f;  // Slower for impact
-                break;
-            case AnimationType::DEATH:
-                m_frameTime = 0.15f;  // Slower for impact
-                break;
-            default:
-                m_frameTime = 0.2f;   // Normal speed
-                break;
-        }
     }
 }
 
 void Player::updateAnimation(float deltaTime) {
+    static_assert(clipsMatchLayout(), "Clip table rows must be in AnimationType order and cover the whole sheet");
+    static_assert(!s_clips[static_cast<int>(AnimationType::DEATH)].loops, "Death must hold its last frame");
+
+    const AnimationClip& clip = s_clips[static_cast<int>(m_currentAnimation)];
     m_frameTimer += deltaTime;
     
-    if (m_frameTimer >= m_frameTime) {
+    if (m_frameTimer >= clip.frameDurations[m_frameIndex]) {
         m_frameTimer = 0.0f;
         m_frameIndex++;
         
-        // Check if animation should loop or complete
-        bool shouldLoop = true;
-        switch (m_currentAnimation) {
-            case AnimationType::SWORD_ATTACK1:
-            // case AnimationType::SWORD_ATTACK1_END:
-            case AnimationType::SWORD_ATTACK2:
-            // case AnimationType::BOW_ATTACK1:
-            // case AnimationType::BOW_ATTACK1_END:
-            // case AnimationType::BOW_ATTACK2:
-            // case AnimationType::SWORD_SPECIAL:
-            // case AnimationType::BOW_SPECIAL:
-            case AnimationType::TAKE_DAMAGE:
-            case AnimationType::DEATH:
-            case AnimationType::DASH:
-                shouldLoop = false;  // These animations play once
-                break;
-            default:
-                shouldLoop = true;   // Idle, run animations loop
-                break;
-        }
-        
-        if (m_frameIndex >= FRAMES_PER_ANIMATION) {
-            if (shouldLoop) {
+        if (m_frameIndex >= clip.frameCount) {
+            if (clip.loops) {
                 m_frameIndex = 0;  // Loop back to start
             } else {
-                m_frameIndex = FRAMES_PER_ANIMATION - 1;  // Stay on last frame
+                m_frameIndex = clip.frameCount - 1;  // Stay on last frame
                 m_animationComplete = true;
             }
         }
     }
     
-    // Calculate the source rectangle for current frame
-    // Assuming sprite sheet layout: [Animation_Row][Direction_Column * FRAMES_PER_ANIMATION + Frame]
-    int animationRow = static_cast<int>(m_currentAnimation);
-    int directionOffset = static_cast<int>(m_direction);
-
-    // Bounds checking
-    if (animationRow < 0 || animationRow >= TOTAL_ANIMATIONS) animationRow = 0;
-    if (directionOffset < 0 || directionOffset >= DIRECTIONS_PER_ANIMATION) directionOffset = 0;
-    if (m_frameIndex < 0 || m_frameIndex >= FRAMES_PER_ANIMATION) m_frameIndex = 0;
-    
-    // For directional animations (most animations have 4 directions)
-    bool isDirectional = true; // m_currentAnimation != AnimationType::DEATH;
-    
-    // Calculate the full frame position
-    int baseX, baseY;
-    if (isDirectional) {
-        baseX = (directionOffset * FRAMES_PER_ANIMATION + m_frameIndex) * FRAME_WIDTH;
-        baseY = animationRow * FRAME_HEIGHT;
-    } else {
-        // Non-directional animations (special attacks, death)
-        m_currentFrame.x = m_frameIndex * FRAME_WIDTH;
-        m_currentFrame.y = animationRow * FRAME_HEIGHT;
-    }
-    
-    // NEW: Apply cropping to remove empty space
-    m_currentFrame.x = baseX + CHAR_CROP_X;           // Offset into the frame
-    m_currentFrame.y = baseY + CHAR_CROP_Y;           // Offset into the frame  
-    m_currentFrame.w = CHAR_CROP_WIDTH;               // Smaller width
-    m_currentFrame.h = CHAR_CROP_HEIGHT;              // Smaller height
+    m_currentFrame = clip.cells[static_cast<int>(m_direction)][m_frameIndex];
 }
 
 AnimationType Player::getIdleAnimation() const {
@@ -262,7 +215,7 @@ void Player::update(float deltaTime) {
     m_animationTimer += deltaTime;
 
     // Regenerate stamina
-    if (m_state == PlayerState::DODGING || m_state == PlayerState::ATTACKING) {
+    if (state() == PlayerState::DODGING || state() == PlayerState::ATTACKING) {
         m_timeSinceStaminaUse = 0.0f;
     } else {
         m_timeSinceStaminaUse += deltaTime;
@@ -273,18 +226,18 @@ void Player::update(float deltaTime) {
     }
     
     // Update facing direction based on movement (not boss position)
-    if (m_state == PlayerState::MOVING && m_velocity.length() > 0) {
-        m_facingDirection = m_velocity.normalized();
+    if (state() == PlayerState::MOVING && velocity().length() > 0) {
+        m_facingDirection = velocity().normalized();
     }
  
     // Update state
-    // switch (m_state) {
+    // switch (state()) {
     //     case PlayerState::ATTACKING:
     //         m_stateTimer -= deltaTime;
     //         // Animate sword swing
     //         m_swordAngle = -M_PI/3 + (M_PI * 2/3 * (0.3f - m_stateTimer) / 0.3f);
     //         if (m_stateTimer <= 0) {
-    //             m_state = PlayerState::IDLE;
+    //             setState(PlayerState::IDLE);
     //             // m_attackCooldown = 0.5f;
     //             m_swordAngle = 0;
     //         }
@@ -292,14 +245,14 @@ void Player::update(float deltaTime) {
     //
     //     case PlayerState::DODGING:
     //         m_stateTimer -= deltaTime;
-    //         m_position = m_position + m_dodgeDirection * m_dodgeSpeed * deltaTime;
+    //         position() = position() + m_dodgeDirection * m_dodgeSpeed * deltaTime;
     //         if (m_stateTimer <= 0) {
-    //             m_state = PlayerState::IDLE;
+    //             setState(PlayerState::IDLE);
     //         }
     //         break;
     //
     //     case PlayerState::MOVING:
-    //         m_position = m_position + m_velocity * deltaTime;
+    //         position() = position() + velocity() * deltaTime;
     //         // Sword bob while moving
     //         m_swordAngle = sin(m_animationTimer * 3) * 0.15f;
     //         break;
@@ -316,17 +269,17 @@ void Player::update(float deltaTime) {
 
     float progress = (0.6f - m_stateTimer) / 0.6f;  // 0.0 to 1.0
     // Handle state transitions and animations
-    switch (m_state) {
+    switch (state()) {
         case PlayerState::IDLE:
             setAnimation(getIdleAnimation());
             break;
             
         case PlayerState::MOVING:
             setAnimation(getRunAnimation());
-            m_position = m_position + m_velocity * deltaTime;
-            break;
+            break;  // Keeps the velocity move() chose
             
         case PlayerState::ATTACKING:
+            velocity() = Vector2D(0, 0);
             m_stateTimer -= deltaTime;
             // Set attack animation if not already set
             if (m_currentAnimation != getAttackAnimation()) {
@@ -337,7 +290,7 @@ void Player::update(float deltaTime) {
 
             // Check if attack animation is complete
             if (m_animationComplete) {
-                m_state = PlayerState::IDLE;
+                setState(PlayerState::IDLE);
                 m_hasDealtDamage = false;
                 m_swordAngle = 0;
             }
@@ -346,60 +299,63 @@ void Player::update(float deltaTime) {
         case PlayerState::DODGING:
             setAnimation(AnimationType::DASH);
             m_stateTimer -= deltaTime;
-            m_position = m_position + m_dodgeDirection * m_dodgeSpeed * deltaTime;
+            velocity() = m_dodgeDirection * m_dodgeSpeed;  // Still applied on the tick the dodge ends
             
             if (m_stateTimer <= 0 || m_animationComplete) {
-                m_state = PlayerState::IDLE;
+                setState(PlayerState::IDLE);
             }
             break;
             
         case PlayerState::TAKING_DAMAGE:
+            velocity() = Vector2D(0, 0);
             setAnimation(AnimationType::TAKE_DAMAGE);
             if (m_animationComplete) {
-                m_state = PlayerState::IDLE;
+                setState(PlayerState::IDLE);
             }
             break;
             
         case PlayerState::DYING:
+            velocity() = Vector2D(0, 0);
             setAnimation(AnimationType::DEATH);
             // Stay in dying state until animation completes
             if (m_animationComplete) {
-                m_state = PlayerState::DEAD;
+                setState(PlayerState::DEAD);
             }
             break;
             
         case PlayerState::DEAD:
             // Stay on last frame of death animation
+            velocity() = Vector2D(0, 0);
             break;
     }
     
     updateAnimation(deltaTime);
+}
 
+void Player::setWindowBounds(float width, float height) {
     // Keep player within window bounds
-    float halfWidth = m_width / 2;
-    float halfHeight = m_height / 2;
-    m_position.x = std::max(halfWidth, std::min(m_windowWidth - halfWidth, m_position.x));
-    m_position.y = std::max(halfHeight, std::min(m_windowHeight - halfHeight, m_position.y));
-
-    updateSwordPosition();
+    float halfWidth = getWidth() / 2;
+    float halfHeight = getHeight() / 2;
+    setMoveBounds(Vector2D(halfWidth, halfHeight),
+                  Vector2D(GameUnits::toMeters(width) - halfWidth, GameUnits::toMeters(height) - halfHeight));
 }
 
 void Player::debugSizes() {
     std::cout << "=== PLAYER SIZE DEBUG ===" << std::endl;
     
     // Entity logical size (in meters)
-    std::cout << "Entity size (meters): " << m_width << " x " << m_height << std::endl;
+    std::cout << "Entity size (meters): " << getWidth() << " x " << getHeight() << std::endl;
     
     // Entity size in pixels
-    float widthPixels = GameUnits::toPixels(m_width);
-    float heightPixels = GameUnits::toPixels(m_height);
+    float widthPixels = GameUnits::toPixels(getWidth());
+    float heightPixels = GameUnits::toPixels(getHeight());
     std::cout << "Entity size (pixels): " << widthPixels << " x " << heightPixels << std::endl;
     
     // Sprite frame size
     std::cout << "Sprite frame size: " << FRAME_WIDTH << " x " << FRAME_HEIGHT << std::endl;
     
     // Position
-    Vector2D pixelPos = GameUnits::toPixels(m_position);
+    Vector2D pixelPos = GameUnits::toPixels(position());
     std::cout << "Position (pixels): " << pixelPos.x << ", " << pixelPos.y << std::endl;
     
     // Render position
@@ -415,55 +371,49 @@ void Player::debugSizes() {
     std::cout << "======================" << std::endl;
 }
 
-void Player::render(SDL_Renderer* renderer) {
+void Player::render(Renderer& renderer) {
     static bool debugPrinted = false;
     if (!debugPrinted) {
         debugSizes();
         debugPrinted = true;
     }
 
-    Vector2D pixelPos = GameUnits::toPixels(m_position);
+    Vector2D pixelPos = GameUnits::toPixels(position());
     
     // Calculate render position (center the sprite on the entity position)
     int renderX = (int)pixelPos.x - FRAME_WIDTH / 2;
     int renderY = (int)pixelPos.y - FRAME_HEIGHT / 2;
     
-    if (s_textureLoaded) {
-        float spriteScale = 2.5f; // Adjust as needed
-        int renderWidth = (int)(CHAR_CROP_WIDTH * spriteScale);
-        int renderHeight = (int)(CHAR_CROP_HEIGHT * spriteScale);
-        
-        int renderX = (int)pixelPos.x - renderWidth / 2;
-        int renderY = (int)pixelPos.y - renderHeight / 2;
+    if (s_playerSpriteSheet && s_spriteFrames[m_currentFrame].source.w > 0) {
+        const float spriteScale = 2.5f; // Adjust as needed
+        const SpriteFrame& frame = s_spriteFrames[m_currentFrame];
+
+        // The trimmed frame is placed so the centre of its original cell sits on the entity
+        int renderWidth = (int)(frame.source.w * spriteScale);
+        int renderHeight = (int)(frame.source.h * spriteScale);
+        int renderX = (int)pixelPos.x - (int)(frame.pivotX * spriteScale);
+        int renderY = (int)pixelPos.y - (int)(frame.pivotY * spriteScale);
         
-        // Apply color modulation based on state
-        switch (m_state) {
+        // Tint per vertex based on state; the shared sheet's colour and alpha mod stay untouched
+        SDL_Color tint;
+        switch (state()) {
             case PlayerState::ATTACKING:
-                s_playerSpriteSheet.setColor(255, 255, 150);  // Yellowish tint
+                tint = {255, 255, 150, 255};  // Yellowish tint
                 break;
             case PlayerState::DODGING:
-                s_playerSpriteSheet.setColor(150, 150, 255);  // Bluish tint
-                s_playerSpriteSheet.setAlpha(180);  // Semi-transparent
+                tint = {150, 150, 255, 180};  // Bluish tint, semi-transparent
                 break;
             default:
-                s_playerSpriteSheet.setColor(255, 255, 255);  // Normal color
-                s_playerSpriteSheet.setAlpha(255);  // Fully opaque
+                tint = {255, 255, 255, 255};  // Normal color
                 break;
         }
         
-        // Render the sprite
-        // s_playerSpriteSheet.render(renderX, renderY, &m_currentFrame);
-        
-        // Render the CROPPED sprite (no empty space)
         SDL_Rect destRect = {renderX, renderY, renderWidth, renderHeight};
-        SDL_RenderCopy(renderer, s_playerSpriteSheet.getTexture(), &m_currentFrame, &destRect);
-
-        // Reset color modulation
-        s_playerSpriteSheet.setColor(255, 255, 255);
-        s_playerSpriteSheet.setAlpha(255);
+        renderer.drawSprite(s_playerSpriteSheet->getTexture(), s_playerSpriteSheet->getWidth(),
+                            s_playerSpriteSheet->getHeight(), frame.source, destRect, tint);
     } else {
         SDL_Color color;
-        switch (m_state) {
+        switch (state()) {
             case PlayerState::ATTACKING:
                 color = {255, 255, 0, 255}; // Yellow when attacking
                 break;
@@ -475,17 +425,16 @@ void Player::render(SDL_Renderer* renderer) {
                 break;
         }
         
-        Vector2D pixelPos = GameUnits::toPixels(m_position);
-        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-        SDL_Rect rect = getCollisionBox();
-        SDL_RenderFillRect(renderer, &rect);
+        Vector2D pixelPos = GameUnits::toPixels(position());
+        renderer.primitives().setColor(color);
+        renderer.primitives().fillRect(getCollisionBox());
     }
     
     // Draw sword
     // SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255); // Silver sword
     
     // Calculate sword base position (held by the player)
-    Vector2D swordBase = m_position + m_facingDirection * GameUnits::toMeters(15);
+    Vector2D swordBase = position() + m_facingDirection * GameUnits::toMeters(15);
     
     // Calculate sword tip based on angle
     float totalAngle = atan2(m_facingDirection.y, m_facingDirection.x) + m_swordAngle;
@@ -506,22 +455,22 @@ void Player::render(SDL_Renderer* renderer) {
 }
 
 void Player::move(const Vector2D& direction) {
-    if (m_state == PlayerState::IDLE || m_state == PlayerState::MOVING) {
+    if (state() == PlayerState::IDLE || state() == PlayerState::MOVING) {
         if (direction.length() > 0) {
-            m_velocity = direction.normalized() * m_speed;
-            m_state = PlayerState::MOVING;
+            velocity() = direction.normalized() * m_speed;
+            setState(PlayerState::MOVING);
             m_facingDirection = direction.normalized();
             updateDirection(direction);
         } else {
-            m_velocity = Vector2D(0, 0);
-            m_state = PlayerState::IDLE;
+            velocity() = Vector2D(0, 0);
+            setState(PlayerState::IDLE);
         }
     }
 }
 
 void Player::attack() {
     if (canAttack()) {
-        m_state = PlayerState::ATTACKING;
+        setState(PlayerState::ATTACKING);
         m_stateTimer = 0.3f;
         m_attackCooldown = 0.7f;
         m_currentStamina -= 20.0f;
@@ -531,13 +480,13 @@ void Player::attack() {
 }
 
 void Player::takeDamage(float damage) {
-    if (m_state != PlayerState::TAKING_DAMAGE && m_state != PlayerState::DYING && !isInvulnerable()) {
+    if (state() != PlayerState::TAKING_DAMAGE && state() != PlayerState::DYING && !isInvulnerable()) {
         Entity::takeDamage(damage);  // Call base class method
         
-        if (m_currentHealth <= 0) {
-            m_state = PlayerState::DYING;
+        if (health() <= 0) {
+            setState(PlayerState::DYING);
         } else {
-            m_state = PlayerState::TAKING_DAMAGE;
+            setState(PlayerState::TAKING_DAMAGE);
             m_stateTimer = 0.3f;  // Brief damage state
         }
     }
@@ -545,7 +494,7 @@ void Player::takeDamage(float damage) {
 
 void Player::dodge(const Vector2D& direction) {
     if (canDodge()) {
-        m_state = PlayerState::DODGING;
+        setState(PlayerState::DODGING);
         m_stateTimer = m_dodgeDuration;
         m_dodgeCooldown = 0.5f;
         m_dodgeDirection = direction.normalized();
@@ -557,29 +506,29 @@ void Player::dodge(const Vector2D& direction) {
 }
 
 bool Player::canAttack() const {
-    return (m_state == PlayerState::IDLE || m_state == PlayerState::MOVING) && 
+    return (state() == PlayerState::IDLE || state() == PlayerState::MOVING) && 
            m_attackCooldown <= 0 && m_currentStamina >= 20.0f;
 }
 
 
 bool Player::canDodge() const {
-    return (m_state == PlayerState::IDLE || m_state == PlayerState::MOVING) && 
+    return (state() == PlayerState::IDLE || state() == PlayerState::MOVING) && 
            m_dodgeCooldown <= 0 && m_currentStamina >= 0.0f;
 }
 
 bool Player::isInvulnerable() const {
-    return m_state == PlayerState::DODGING;
+    return state() == PlayerState::DODGING;
 }
 
 void Player::updateSwordPosition() {
     float angle = atan2(m_facingDirection.y, m_facingDirection.x) + m_swordAngle;
-    Vector2D swordBase = m_position + m_facingDirection * GameUnits::toMeters(15);
+    Vector2D swordBase = position() + m_facingDirection * GameUnits::toMeters(15);
     m_swordTipPosition = swordBase + Vector2D(cos(angle), sin(angle)) * m_swordLength;
 }
 
 SDL_Rect Player::getSwordHitbox() const {
     // Create a rectangle along the sword's length
-    Vector2D swordBase = m_position + m_facingDirection * GameUnits::toMeters(15);
+    Vector2D swordBase = position() + m_facingDirection * GameUnits::toMeters(15);
     Vector2D pixelPos = GameUnits::toPixels(swordBase);
     Vector2D pixelSwordTip = GameUnits::toPixels(m_swordTipPosition);
 
@@ -3,7 +3,8 @@
 
 #include "Entity.h"
 #include "GameUnits.h"
-#include "LTexture.h"
+#include "TextureCache.h"
+#include "SpriteAtlas.h"
 
 enum class PlayerState {
     IDLE,
@@ -63,9 +64,8 @@ enum class ComboState {
     ATTACK_2
 };
 
-class Player : public Entity {
+class Player final : public Entity {
 private:
-    PlayerState m_state;
     PlayerDirection m_direction;
     WeaponType m_currentWeapon;
     AnimationType m_currentAnimation;
@@ -106,18 +106,13 @@ private:
     // State timers
     float m_stateTimer;
     float m_animationTimer;
-    
-    // Window boundaries
-    float m_windowWidth;
-    float m_windowHeight;
 
     // Sprite rendering
-    static LTexture s_playerSpriteSheet;  // Shared texture for all players
-    static bool s_textureLoaded;          // Track if texture is loaded
+    static TextureHandle s_playerSpriteSheet;  // Packed atlas shared by all players, null until loaded
+    static std::vector<SpriteFrame> s_spriteFrames;  // Per sheet cell, row-major
 
-    SDL_Rect m_currentFrame;
+    int m_currentFrame;          // Index into s_spriteFrames
     int m_frameIndex;
-    float m_frameTime;
     float m_frameTimer;
     bool m_animationComplete;    
 
@@ -127,14 +122,23 @@ private:
     static const int FRAME_HEIGHT = 128;
     static const int DIRECTIONS_PER_ANIMATION = 4;  // 4 directions (if applicable)
     static const int TOTAL_ANIMATIONS = 7;  // 4 directions (if applicable)
-    
-    // NEW: Cropping constants to remove empty space
-    static const int CHAR_CROP_X = 24;      // How many pixels to crop from left
-    static const int CHAR_CROP_Y = 16;      // How many pixels to crop from top  
-    static const int CHAR_CROP_WIDTH = 80;  // Actual character width
-    static const int CHAR_CROP_HEIGHT = 96; // A
+
+    // One animation, fully resolved at compile time so a tick is a lookup plus a timer
+    struct AnimationClip {
+        AnimationType anim;                           // Key; must equal the clip's index in s_clips
+        int frameCount;
+        bool loops;                                   // Otherwise holds the last frame and reports complete
+        float frameDurations[FRAMES_PER_ANIMATION];   // Seconds per frame
+        int cells[DIRECTIONS_PER_ANIMATION][FRAMES_PER_ANIMATION];  // Sheet cell per PlayerDirection and frame
+    };
+
+    static constexpr AnimationClip makeClip(AnimationType anim, float frameDuration, bool loops);
+    static const AnimationClip s_clips[TOTAL_ANIMATIONS];  // Indexed by AnimationType
+    static constexpr bool clipsMatchLayout();  // Every row keyed by its index, every cell where the sheet has it
 
     void updateSwordPosition();
+    PlayerState state() const { return static_cast<PlayerState>(getAnimStateValue()); }
+    void setState(PlayerState state) { setAnimStateValue(static_cast<int>(state)); }
     void updateAnimation(float deltaTime);
     void updateDirection(const Vector2D& moveDir);
     void setAnimation(AnimationType animation);
@@ -155,43 +159,43 @@ private:
     float m_attack2Duration = 0.5f;  // How long attack 2 lasts
     //
 public:
-    Player(float x, float y);
+    Player(EntityStore& store, float x, float y);
     ~Player();
 
-    // Static method to load shared texture
-    static bool loadTexture(SDL_Renderer* renderer, const std::string& path);
-    static void freeTexture();
+    // Installs the shared packed sheet (see SpriteAtlas); false if it does not fit the expected layout
+    static bool setSpriteSheet(const TextureHandle& atlas, const std::vector<SpriteFrame>& frames);
+    static void freeTexture();  // Releases the handle; the cache decides when the texture goes
+    static int getFrameWidth() { return FRAME_WIDTH; }    // Sheet cell size, for packing and asset bundles
+    static int getFrameHeight() { return FRAME_HEIGHT; }
 
     void debugSizes();
     void update(float deltaTime) override;
-    void render(SDL_Renderer* renderer) override;
+    void onMoved() override { updateSwordPosition(); }
+    void render(Renderer& renderer) override;
     
     void move(const Vector2D& direction);
     void attack();
     void dodge(const Vector2D& direction);
-    void setWindowBounds(float width, float height) { 
-        m_windowWidth = GameUnits::toMeters(width); 
-        m_windowHeight = GameUnits::toMeters(height); 
-    }
+    void setWindowBounds(float width, float height);  // Pixels; the player's whole body stays inside
     void takeDamage(float damage) override;
     
     bool canAttack() const;
     bool canDodge() const;
     bool isInvulnerable() const;
-    bool isAttacking() const { return m_state == PlayerState::ATTACKING; }
+    bool isAttacking() const { return state() == PlayerState::ATTACKING; }
     bool isAnimationComplete() const { return m_animationComplete; }
     
     float getAttackDamage() const { return m_attackDamage; }
     float getAttackRange() const { return m_attackRange; }
     float getStaminaPercentage() const { return m_currentStamina / m_maxStamina; }
-    PlayerState getState() const { return m_state; }
+    PlayerState getState() const { return state(); }
     WeaponType getCurrentWeapon() const { return m_currentWeapon; }
     bool hasDealtDamage() const { return m_hasDealtDamage; }
     void setDamageDealt() { m_hasDealtDamage = true; }
 
     // Get sword hitbox for collision detection
     SDL_Rect getSwordHitbox() const;
-    Circle getAttackCircle() const { return Circle(m_position.x, m_position.y, m_attackRange); }
+    Circle getAttackCircle() const { return Circle(position().x, position().y, m_attackRange); }
 };
 
 #endif
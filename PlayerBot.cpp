@@ -0,0 +1,98 @@
+#include "PlayerBot.h"
+#include "Player.h"
+#include "Boss.h"
+
+PlayerBot::PlayerBot(Style style, unsigned int seed)
+    : m_style(style), m_rng(seed),
+      m_threatSeen(false), m_willDodge(false), m_reactionTimer(0.0f),
+      m_strafeTimer(0.0f), m_strafeSign(1.0f) {}
+
+bool PlayerBot::parseStyle(const std::string& name, Style& style) {
+    if (name == "aggressive") {
+        style = Style::AGGRESSIVE;
+    } else if (name == "cautious") {
+        style = Style::CAUTIOUS;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* PlayerBot::styleName(Style style) {
+    switch (style) {
+        case Style::AGGRESSIVE: return "aggressive";
+        case Style::CAUTIOUS: return "cautious";
+        default: return "unknown";
+    }
+}
+
+float PlayerBot::randomFloat(float min, float max) {
+    std::uniform_real_distribution<float> dist(min, max);
+    return dist(m_rng);
+}
+
+Vector2D PlayerBot::toKeyDirection(const Vector2D& direction) {
+    // Snap to the 8 directions WASD can produce (sin 22.5 deg ~= 0.38)
+    Vector2D dir = direction.normalized();
+    Vector2D keys(0, 0);
+    if (dir.x > 0.38f) keys.x = 1;
+    if (dir.x < -0.38f) keys.x = -1;
+    if (dir.y > 0.38f) keys.y = 1;
+    if (dir.y < -0.38f) keys.y = -1;
+    return keys.normalized();
+}
+
+PlayerInput PlayerBot::think(const Player& player, const Boss& boss, float deltaTime) {
+    PlayerInput input;
+
+    Vector2D toBoss = boss.getPosition() - player.getPosition();
+    float distance = toBoss.length();
+    Vector2D side(-toBoss.y * m_strafeSign, toBoss.x * m_strafeSign);
+
+    m_strafeTimer -= deltaTime;
+    if (m_strafeTimer <= 0) {
+        m_strafeTimer = randomFloat(1.0f, 3.0f);
+        if (randomFloat(0.0f, 1.0f) < 0.5f) m_strafeSign = -m_strafeSign;
+    }
+
+    // Telegraphed boss attack in reach: decide once per attack whether and when to dodge
+    bool threatened = (boss.isWindingUp() || boss.isAttacking()) &&
+                      distance < boss.getAttackRange() + 2.0f;
+    if (threatened && !m_threatSeen) {
+        bool cautious = m_style == Style::CAUTIOUS;
+        m_willDodge = randomFloat(0.0f, 1.0f) < (cautious ? 0.85f : 0.4f);
+        m_reactionTimer = cautious ? randomFloat(0.15f, 0.45f) : randomFloat(0.3f, 0.6f);
+    }
+    m_threatSeen = threatened;
+
+    if (threatened) {
+        m_reactionTimer -= deltaTime;
+        if (m_willDodge && m_reactionTimer <= 0 && player.canDodge()) {
+            // Roll sideways and slightly away from the blade
+            input.moveDir = toKeyDirection(side.normalized() - toBoss.normalized() * 0.5f);
+            input.dodge = true;
+            m_willDodge = false;
+            return input;
+        }
+    }
+
+    // Sword reaches a little past attack range, and the boss body keeps us from closing further
+    float engageRange = player.getAttackRange() + 0.5f;
+    if (distance > engageRange) {
+        input.moveDir = toKeyDirection(toBoss);
+        return input;
+    }
+
+    bool safeToSwing = m_style == Style::AGGRESSIVE || !boss.isWindingUp() || boss.isRecovering();
+    if (safeToSwing && player.canAttack()) {
+        // Face the boss so the swing connects
+        input.moveDir = toKeyDirection(toBoss);
+        input.attack = true;
+    } else if (player.getStaminaPercentage() < 0.3f) {
+        input.moveDir = toKeyDirection(toBoss * -1);  // Back off to regain stamina
+    } else {
+        input.moveDir = toKeyDirection(side);
+    }
+
+    return input;
+}
@@ -0,0 +1,45 @@
+#ifndef PLAYERBOT_H
+#define PLAYERBOT_H
+
+#include <random>
+#include <string>
+#include "InputHandler.h"
+#include "Vector2D.h"
+
+class Player;
+class Boss;
+
+// Scripted stand-in for a human player, used by headless and batch fights.
+// Emits the same 8-way movement and press inputs a keyboard would.
+class PlayerBot {
+public:
+    enum class Style {
+        AGGRESSIVE,  // Trades hits, dodges only some telegraphed attacks
+        CAUTIOUS     // Dodges most attacks, punishes during recovery
+    };
+
+    PlayerBot(Style style, unsigned int seed);
+
+    PlayerInput think(const Player& player, const Boss& boss, float deltaTime);
+
+    static bool parseStyle(const std::string& name, Style& style);
+    static const char* styleName(Style style);
+
+private:
+    Style m_style;
+    std::mt19937 m_rng;
+
+    // Reaction to the current boss attack
+    bool m_threatSeen;
+    bool m_willDodge;
+    float m_reactionTimer;
+
+    // Circling direction, flipped now and then
+    float m_strafeTimer;
+    float m_strafeSign;
+
+    float randomFloat(float min, float max);
+    static Vector2D toKeyDirection(const Vector2D& direction);
+};
+
+#endif
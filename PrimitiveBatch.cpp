@@ -0,0 +1,131 @@
+#include "PrimitiveBatch.h"
+#include "FrameCounters.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    bool sameColor(const SDL_Color& a, const SDL_Color& b) {
+        return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+    }
+}
+
+PrimitiveBatch::PrimitiveBatch() : m_color{255, 255, 255, 255} {}
+
+void PrimitiveBatch::beginShape() {
+    if (!m_runs.empty() && sameColor(m_runs.back().color, m_color)) return;
+    m_runs.push_back(Run{m_color, m_points.size(), m_lines.size(), m_rects.size(), m_fills.size(), m_vertices.size()});
+}
+
+void PrimitiveBatch::point(int x, int y) {
+    beginShape();
+    m_points.push_back(SDL_Point{x, y});
+}
+
+void PrimitiveBatch::line(int x1, int y1, int x2, int y2) {
+    // Axis-aligned lines are exactly a 1 px wide rect, which batches better
+    if (x1 == x2) {
+        fillRect(SDL_Rect{x1, std::min(y1, y2), 1, std::abs(y2 - y1) + 1});
+        return;
+    }
+    if (y1 == y2) {
+        fillRect(SDL_Rect{std::min(x1, x2), y1, std::abs(x2 - x1) + 1, 1});
+        return;
+    }
+
+    beginShape();
+    m_lines.push_back(SDL_Point{x1, y1});
+    m_lines.push_back(SDL_Point{x2, y2});
+}
+
+void PrimitiveBatch::rect(const SDL_Rect& rect) {
+    beginShape();
+    m_rects.push_back(rect);
+}
+
+void PrimitiveBatch::fillRect(const SDL_Rect& rect) {
+    beginShape();
+    m_fills.push_back(rect);
+}
+
+void PrimitiveBatch::thickLine(float x1, float y1, float x2, float y2, float width) {
+    float dx = x2 - x1;
+    float dy = y2 - y1;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length <= 0.0f) return;
+
+    // Offset both ends by half the width along the normal
+    float nx = -dy / length * width * 0.5f;
+    float ny = dx / length * width * 0.5f;
+
+    beginShape();
+    SDL_FPoint noUV = {0.0f, 0.0f};
+    SDL_Vertex a = {{x1 + nx, y1 + ny}, m_color, noUV};
+    SDL_Vertex b = {{x2 + nx, y2 + ny}, m_color, noUV};
+    SDL_Vertex c = {{x2 - nx, y2 - ny}, m_color, noUV};
+    SDL_Vertex d = {{x1 - nx, y1 - ny}, m_color, noUV};
+    m_vertices.push_back(a);
+    m_vertices.push_back(b);
+    m_vertices.push_back(c);
+    m_vertices.push_back(a);
+    m_vertices.push_back(c);
+    m_vertices.push_back(d);
+}
+
+void PrimitiveBatch::flush(SDL_Renderer* renderer) {
+    if (m_runs.empty()) return;
+
+    int calls = 0;
+
+    for (size_t i = 0; i < m_runs.size(); ++i) {
+        const Run& run = m_runs[i];
+        bool last = i + 1 == m_runs.size();
+        size_t pointEnd = last ? m_points.size() : m_runs[i + 1].pointStart;
+        size_t lineEnd = last ? m_lines.size() : m_runs[i + 1].lineStart;
+        size_t rectEnd = last ? m_rects.size() : m_runs[i + 1].rectStart;
+        size_t fillEnd = last ? m_fills.size() : m_runs[i + 1].fillStart;
+        size_t vertexEnd = last ? m_vertices.size() : m_runs[i + 1].vertexStart;
+
+        SDL_SetRenderDrawColor(renderer, run.color.r, run.color.g, run.color.b, run.color.a);
+
+        if (fillEnd > run.fillStart) {
+            SDL_RenderFillRects(renderer, &m_fills[run.fillStart], (int)(fillEnd - run.fillStart));
+            ++calls;
+        }
+        if (rectEnd > run.rectStart) {
+            SDL_RenderDrawRects(renderer, &m_rects[run.rectStart], (int)(rectEnd - run.rectStart));
+            ++calls;
+        }
+        if (pointEnd > run.pointStart) {
+            SDL_RenderDrawPoints(renderer, &m_points[run.pointStart], (int)(pointEnd - run.pointStart));
+            ++calls;
+        }
+
+        // Segments that continue from the previous one's end share a polyline call
+        size_t segment = run.lineStart;
+        while (segment < lineEnd) {
+            m_chain.clear();
+            m_chain.push_back(m_lines[segment]);
+            m_chain.push_back(m_lines[segment + 1]);
+            segment += 2;
+            while (segment < lineEnd && m_lines[segment].x == m_chain.back().x && m_lines[segment].y == m_chain.back().y) {
+                m_chain.push_back(m_lines[segment + 1]);
+                segment += 2;
+            }
+            SDL_RenderDrawLines(renderer, m_chain.data(), (int)m_chain.size());
+            ++calls;
+        }
+
+        if (vertexEnd > run.vertexStart) {
+            SDL_RenderGeometry(renderer, nullptr, &m_vertices[run.vertexStart], (int)(vertexEnd - run.vertexStart), nullptr, 0);
+            ++calls;
+        }
+    }
+
+    m_runs.clear();
+    m_points.clear();
+    m_lines.clear();
+    m_rects.clear();
+    m_fills.clear();
+    m_vertices.clear();
+    FrameCounters::addDrawCalls(calls);
+}
@@ -0,0 +1,51 @@
+#ifndef PRIMITIVE_BATCH_H
+#define PRIMITIVE_BATCH_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// Collects points, lines, rect outlines, filled rects and solid quads, grouped
+// into runs of consecutive submissions with the same colour. flush() draws each
+// run with one call per primitive kind instead of one call per shape.
+// Draw order is kept between runs. Within a run every shape has the same
+// colour, so drawing them grouped by kind gives the same pixels.
+class PrimitiveBatch {
+public:
+    PrimitiveBatch();
+
+    void setColor(SDL_Color color) { m_color = color; }
+    void setColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255) { m_color = SDL_Color{r, g, b, a}; }
+
+    void point(int x, int y);
+    void line(int x1, int y1, int x2, int y2);   // Axis-aligned lines become 1 px filled rects
+    void rect(const SDL_Rect& rect);
+    void fillRect(const SDL_Rect& rect);
+    void thickLine(float x1, float y1, float x2, float y2, float width);   // Solid quad via geometry
+
+    // Draws everything queued and empties the batch
+    void flush(SDL_Renderer* renderer);
+    bool empty() const { return m_runs.empty(); }
+
+private:
+    struct Run {
+        SDL_Color color;
+        size_t pointStart;
+        size_t lineStart;
+        size_t rectStart;
+        size_t fillStart;
+        size_t vertexStart;
+    };
+
+    void beginShape();
+
+    SDL_Color m_color;
+    std::vector<Run> m_runs;
+    std::vector<SDL_Point> m_points;
+    std::vector<SDL_Point> m_lines;      // Segment endpoints, two per line
+    std::vector<SDL_Rect> m_rects;
+    std::vector<SDL_Rect> m_fills;
+    std::vector<SDL_Vertex> m_vertices;  // Triangle list
+    std::vector<SDL_Point> m_chain;      // Scratch for joining segments into polylines
+};
+
+#endif
@@ -0,0 +1,130 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <iomanip>
+#include <vector>
+
+const int Profiler::WINDOW_FRAMES;  // std::min takes it by reference
+
+Profiler::Profiler()
+    : m_enabled(false), m_frameStart(0),
+      m_frameStartDrawCalls(0), m_frameStartAllocations(0), m_lastDrawCalls(0), m_lastAllocations(0),
+      m_lifetimeDrawCalls(0), m_lifetimeAllocations(0), m_head(0), m_filled(0), m_frameCount(0) {
+    std::fill(&m_current[0], &m_current[0] + PHASE_COUNT, 0.0);
+    std::fill(&m_history[0][0], &m_history[0][0] + PHASE_COUNT * WINDOW_FRAMES, 0.0);
+    std::fill(&m_lifetimeTotal[0], &m_lifetimeTotal[0] + PHASE_COUNT, 0.0);
+}
+
+double Profiler::toMs(Uint64 ticks) {
+    static const double msPerTick = 1000.0 / (double)SDL_GetPerformanceFrequency();
+    return ticks * msPerTick;
+}
+
+void Profiler::beginFrame() {
+    if (!m_enabled) return;
+
+    std::fill(&m_current[0], &m_current[0] + PHASE_COUNT, 0.0);
+    m_frameStartDrawCalls = FrameCounters::getDrawCalls();
+    m_frameStartAllocations = FrameCounters::getAllocations();
+    m_frameStart = now();
+}
+
+void Profiler::endFrame() {
+    if (!m_enabled) return;
+
+    Uint64 frameEnd = now();
+    m_current[static_cast<int>(ProfilePhase::FRAME)] = toMs(frameEnd - m_frameStart);
+    Trace::complete(phaseName(ProfilePhase::FRAME), "frame", m_frameStart, frameEnd);
+
+    m_lastDrawCalls = FrameCounters::getDrawCalls() - m_frameStartDrawCalls;
+    m_lastAllocations = FrameCounters::getAllocations() - m_frameStartAllocations;
+    m_lifetimeDrawCalls += m_lastDrawCalls;
+    m_lifetimeAllocations += m_lastAllocations;
+
+    for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+        m_history[phase][m_head] = m_current[phase];
+        m_lifetimeTotal[phase] += m_current[phase];
+    }
+    m_head = (m_head + 1) % WINDOW_FRAMES;
+    m_filled = std::min(m_filled + 1, WINDOW_FRAMES);
+    ++m_frameCount;
+}
+
+void Profiler::addSample(ProfilePhase phase, double ms) {
+    m_current[static_cast<int>(phase)] += ms;
+}
+
+double Profiler::getLastFrameMs(ProfilePhase phase) const {
+    if (m_filled == 0) return 0.0;
+    int last = (m_head + WINDOW_FRAMES - 1) % WINDOW_FRAMES;
+    return m_history[static_cast<int>(phase)][last];
+}
+
+double Profiler::getFrameMs(ProfilePhase phase, int framesAgo) const {
+    if (framesAgo < 0 || framesAgo >= m_filled) return 0.0;
+    int index = (m_head + WINDOW_FRAMES - 1 - framesAgo) % WINDOW_FRAMES;
+    return m_history[static_cast<int>(phase)][index];
+}
+
+PhaseStats Profiler::getStats(ProfilePhase phase) const {
+    PhaseStats stats;
+    if (m_filled == 0) return stats;
+
+    const double* history = m_history[static_cast<int>(phase)];
+    std::vector<double> samples(history, history + m_filled);
+
+    double sum = 0.0;
+    for (double sample : samples) {
+        sum += sample;
+    }
+
+    size_t p99Index = std::min(samples.size() - 1, (size_t)(samples.size() * 0.99));
+    std::nth_element(samples.begin(), samples.begin() + p99Index, samples.end());
+
+    stats.minMs = *std::min_element(samples.begin(), samples.end());
+    stats.maxMs = *std::max_element(samples.begin(), samples.end());
+    stats.avgMs = sum / samples.size();
+    stats.p99Ms = samples[p99Index];
+    stats.samples = m_filled;
+    return stats;
+}
+
+const char* Profiler::phaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::FRAME: return "Frame";
+        case ProfilePhase::HANDLE_EVENTS: return "HandleEvents";
+        case ProfilePhase::UPDATE: return "Update";
+        case ProfilePhase::UPDATE_AI: return "Update/AI";
+        case ProfilePhase::UPDATE_ENTITIES: return "Update/Entities";
+        case ProfilePhase::UPDATE_COLLISION: return "Update/Collision";
+        case ProfilePhase::RENDER: return "Render";
+        case ProfilePhase::RENDER_ENTITIES: return "Render/Entities";
+        case ProfilePhase::RENDER_DEBUG: return "Render/Debug";
+        case ProfilePhase::RENDER_UI: return "Render/UI";
+        case ProfilePhase::RENDER_PRESENT: return "Render/Present";
+        case ProfilePhase::RENDER_HUD: return "Render/HUD";
+        default: return "Unknown";
+    }
+}
+
+void Profiler::dump(std::ostream& out) const {
+    out << "=== Frame Profile (last " << m_filled << " of " << m_frameCount << " frames, ms) ===" << std::endl;
+    out << std::left << std::setw(18) << "Phase" << std::right
+        << std::setw(9) << "min" << std::setw(9) << "avg" << std::setw(9) << "p99"
+        << std::setw(9) << "max" << std::setw(11) << "life avg" << std::endl;
+
+    out << std::fixed << std::setprecision(3);
+    for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+        PhaseStats stats = getStats(static_cast<ProfilePhase>(phase));
+        double lifetimeAvg = m_frameCount > 0 ? m_lifetimeTotal[phase] / m_frameCount : 0.0;
+        out << std::left << std::setw(18) << phaseName(static_cast<ProfilePhase>(phase)) << std::right
+            << std::setw(9) << stats.minMs << std::setw(9) << stats.avgMs
+            << std::setw(9) << stats.p99Ms << std::setw(9) << stats.maxMs
+            << std::setw(11) << lifetimeAvg << std::endl;
+    }
+    if (m_frameCount > 0) {
+        out << std::setprecision(1)
+            << "Draw calls/frame: " << (double)m_lifetimeDrawCalls / m_frameCount
+            << ", allocations/frame: " << (double)m_lifetimeAllocations / m_frameCount << std::endl;
+    }
+    out << std::defaultfloat;
+}
@@ -0,0 +1,112 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <SDL2/SDL.h>
+#include <ostream>
+#include "FrameCounters.h"
+#include "Trace.h"
+
+// Frame phases timed by the profiler. Nested phases are also counted in their parent.
+enum class ProfilePhase {
+    FRAME,             // Whole frame, including the vsync wait in present
+    HANDLE_EVENTS,
+    UPDATE,            // All fixed ticks run this frame
+    UPDATE_AI,
+    UPDATE_ENTITIES,
+    UPDATE_COLLISION,
+    RENDER,
+    RENDER_ENTITIES,
+    RENDER_DEBUG,
+    RENDER_UI,
+    RENDER_PRESENT,
+    RENDER_HUD,        // The performance overlay itself
+    COUNT
+};
+
+struct PhaseStats {
+    double minMs = 0.0;
+    double avgMs = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+    int samples = 0;
+};
+
+// Per-phase frame timings over a rolling window of recent frames.
+// Samples within a frame are summed, so a phase hit once per tick reports its
+// per-frame cost. Disabled profilers skip the clock reads entirely.
+// Draw calls and allocations from FrameCounters are recorded per frame too.
+class Profiler {
+public:
+    static const int WINDOW_FRAMES = 240;
+
+    Profiler();
+
+    void setEnabled(bool enabled) { m_enabled = enabled; }
+    bool isEnabled() const { return m_enabled; }
+
+    void beginFrame();
+    void endFrame();
+    void addSample(ProfilePhase phase, double ms);
+
+    PhaseStats getStats(ProfilePhase phase) const;
+    double getLastFrameMs(ProfilePhase phase) const;
+    double getFrameMs(ProfilePhase phase, int framesAgo) const;  // 0 = last completed frame
+    int getWindowSize() const { return m_filled; }
+    long long getFrameCount() const { return m_frameCount; }
+
+    long long getLastDrawCalls() const { return m_lastDrawCalls; }
+    long long getLastAllocations() const { return m_lastAllocations; }
+
+    void dump(std::ostream& out) const;
+
+    static const char* phaseName(ProfilePhase phase);
+    static Uint64 now() { return SDL_GetPerformanceCounter(); }
+    static double toMs(Uint64 ticks);
+
+private:
+    static const int PHASE_COUNT = static_cast<int>(ProfilePhase::COUNT);
+
+    bool m_enabled;
+    Uint64 m_frameStart;
+    double m_current[PHASE_COUNT];                  // Accumulating for the open frame
+    double m_history[PHASE_COUNT][WINDOW_FRAMES];   // Ring buffer of per-frame totals
+    double m_lifetimeTotal[PHASE_COUNT];
+    long long m_frameStartDrawCalls;
+    long long m_frameStartAllocations;
+    long long m_lastDrawCalls;
+    long long m_lastAllocations;
+    long long m_lifetimeDrawCalls;
+    long long m_lifetimeAllocations;
+    int m_head;
+    int m_filled;
+    long long m_frameCount;
+};
+
+// Adds the time between construction and destruction to a phase,
+// and records it as a trace slice when tracing is on
+class ScopedTimer {
+public:
+    ScopedTimer(Profiler& profiler, ProfilePhase phase)
+        : m_profiler(profiler), m_phase(phase),
+          m_start(profiler.isEnabled() || Trace::isEnabled() ? Profiler::now() : 0) {}
+
+    ~ScopedTimer() {
+        if (m_profiler.isEnabled() || Trace::isEnabled()) {
+            Uint64 end = Profiler::now();
+            if (m_profiler.isEnabled()) {
+                m_profiler.addSample(m_phase, Profiler::toMs(end - m_start));
+            }
+            Trace::complete(Profiler::phaseName(m_phase), "frame", m_start, end);
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Profiler& m_profiler;
+    ProfilePhase m_phase;
+    Uint64 m_start;
+};
+
+#endif
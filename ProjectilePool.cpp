@@ -0,0 +1,102 @@
+#include "ProjectilePool.h"
+#include "GameUnits.h"
+#include "CollisionKernels.h"
+#include <algorithm>
+
+constexpr float ProjectilePool::RADIUS;
+
+ProjectilePool::ProjectilePool()
+    : m_posX(CAPACITY), m_posY(CAPACITY), m_velX(CAPACITY), m_velY(CAPACITY),
+      m_life(CAPACITY), m_damage(CAPACITY), m_owner(CAPACITY), m_detected(CAPACITY),
+      m_candidateX(CAPACITY), m_candidateY(CAPACITY), m_hitMask(CollisionKernels::getMaskWords(CAPACITY)),
+      m_count(0) {}
+
+bool ProjectilePool::spawn(const Vector2D& position, const Vector2D& velocity, float damage, float lifetime,
+                           ProjectileOwner owner) {
+    if (m_count >= CAPACITY) return false;
+
+    int i = m_count++;
+    m_posX[i] = position.x;
+    m_posY[i] = position.y;
+    m_velX[i] = velocity.x;
+    m_velY[i] = velocity.y;
+    m_life[i] = lifetime;
+    m_damage[i] = damage;
+    m_owner[i] = owner;
+    m_detected[i] = 0;
+    return true;
+}
+
+void ProjectilePool::remove(int index) {
+    int last = --m_count;
+    m_posX[index] = m_posX[last];
+    m_posY[index] = m_posY[last];
+    m_velX[index] = m_velX[last];
+    m_velY[index] = m_velY[last];
+    m_life[index] = m_life[last];
+    m_damage[index] = m_damage[last];
+    m_owner[index] = m_owner[last];
+    m_detected[index] = m_detected[last];
+}
+
+void ProjectilePool::update(float deltaTime, float arenaWidth, float arenaHeight) {
+    // Integration has no branches, so it runs over plain arrays
+    float* posX = m_posX.data();
+    float* posY = m_posY.data();
+    float* life = m_life.data();
+    const float* velX = m_velX.data();
+    const float* velY = m_velY.data();
+    for (int i = 0; i < m_count; ++i) {
+        posX[i] += velX[i] * deltaTime;
+        posY[i] += velY[i] * deltaTime;
+        life[i] -= deltaTime;
+    }
+
+    // Walk backwards so the projectile swapped into a hole has already been checked
+    for (int i = m_count - 1; i >= 0; --i) {
+        if (life[i] <= 0.0f || posX[i] < 0.0f || posX[i] > arenaWidth || posY[i] < 0.0f || posY[i] > arenaHeight) {
+            remove(i);
+        }
+    }
+}
+
+float ProjectilePool::collide(const SDL_Rect& box, const std::vector<int>& candidates) {
+    // A shot appears in a query once, so there are never more candidates than CAPACITY
+    int count = (int)candidates.size();
+    for (int k = 0; k < count; ++k) {
+        m_candidateX[k] = m_posX[candidates[k]];
+        m_candidateY[k] = m_posY[candidates[k]];
+    }
+    CollisionKernels::boxVsCircles(GameUnits::toMeters((float)box.x), GameUnits::toMeters((float)box.y),
+                                   GameUnits::toMeters((float)(box.x + box.w)),
+                                   GameUnits::toMeters((float)(box.y + box.h)),
+                                   RADIUS, m_candidateX.data(), m_candidateY.data(), count, m_hitMask.data());
+
+    float damage = 0.0f;
+    for (int k = 0; k < count; ++k) {
+        int i = candidates[k];
+        if (CollisionKernels::isHit(m_hitMask.data(), k) && m_life[i] > 0.0f) {  // Not already spent on another body
+            damage += m_damage[i];
+            m_life[i] = 0.0f;
+        }
+    }
+    return damage;
+}
+
+void ProjectilePool::removeSpent() {
+    for (int i = m_count - 1; i >= 0; --i) {
+        if (m_life[i] <= 0.0f) {
+            remove(i);
+        }
+    }
+}
+
+SDL_Rect ProjectilePool::getBounds(int index) const {
+    float radius = GameUnits::toPixels(RADIUS);
+    return SDL_Rect{
+        (int)(GameUnits::toPixels(m_posX[index]) - radius),
+        (int)(GameUnits::toPixels(m_posY[index]) - radius),
+        (int)(radius * 2.0f) + 1,
+        (int)(radius * 2.0f) + 1
+    };
+}
@@ -0,0 +1,73 @@
+#ifndef PROJECTILE_POOL_H
+#define PROJECTILE_POOL_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include "Vector2D.h"
+
+enum class ProjectileOwner : Uint8 {
+    BOSS,
+    PLAYER
+};
+
+// Every live projectile in the fight, as parallel arrays packed at the front.
+// Storage is allocated once for CAPACITY shots; spawning and expiring never
+// touch the heap, and removal swaps the last live projectile into the hole.
+// Positions and velocities are in meters, like entities.
+class ProjectilePool {
+public:
+    static const int CAPACITY = 4096;
+    static constexpr float RADIUS = 0.3f;  // Meters
+
+private:
+    std::vector<float> m_posX;
+    std::vector<float> m_posY;
+    std::vector<float> m_velX;
+    std::vector<float> m_velY;
+    std::vector<float> m_life;     // Seconds left before it fizzles
+    std::vector<float> m_damage;
+    std::vector<ProjectileOwner> m_owner;
+    std::vector<Uint8> m_detected;  // Already reported to the target's AI
+    std::vector<float> m_candidateX;  // Candidates gathered for the batch narrow phase
+    std::vector<float> m_candidateY;
+    std::vector<Uint32> m_hitMask;
+    int m_count;
+
+    void remove(int index);
+
+public:
+    ProjectilePool();
+
+    // False when the pool is full; the shot is dropped
+    bool spawn(const Vector2D& position, const Vector2D& velocity, float damage, float lifetime, ProjectileOwner owner);
+    void clear() { m_count = 0; }
+
+    // Moves every projectile and drops those that expired or left the arena (meters)
+    void update(float deltaTime, float arenaWidth, float arenaHeight);
+
+    // Of the candidates (indices, usually from a SpatialHash query), marks those that
+    // touch box (pixels) as spent and returns their total damage. Indices stay valid
+    // until removeSpent, so several bodies can be resolved against one broad phase.
+    float collide(const SDL_Rect& box, const std::vector<int>& candidates);
+    void removeSpent();
+
+    SDL_Rect getBounds(int index) const;  // Pixels, for the broad phase
+
+    // Calls onDetected(position) once for each projectile fired by shooter that has not been reported yet
+    template <typename Callback>
+    void detectNew(ProjectileOwner shooter, Callback&& onDetected) {
+        for (int i = 0; i < m_count; ++i) {
+            if (m_owner[i] == shooter && !m_detected[i]) {
+                m_detected[i] = 1;
+                onDetected(Vector2D(m_posX[i], m_posY[i]));
+            }
+        }
+    }
+
+    int size() const { return m_count; }
+    const float* getPositionsX() const { return m_posX.data(); }
+    const float* getPositionsY() const { return m_posY.data(); }
+    const ProjectileOwner* getOwners() const { return m_owner.data(); }
+};
+
+#endif
@@ -0,0 +1,57 @@
+#include "RenderCache.h"
+#include "FrameCounters.h"
+#include <iostream>
+
+RenderCache::RenderCache()
+    : m_texture(nullptr), m_previousTarget(nullptr), m_width(0), m_height(0), m_key(0), m_valid(false) {}
+
+RenderCache::~RenderCache() {
+    free();
+}
+
+void RenderCache::free() {
+    if (m_texture) {
+        SDL_DestroyTexture(m_texture);
+        m_texture = nullptr;
+    }
+    m_valid = false;
+}
+
+bool RenderCache::begin(SDL_Renderer* renderer, int width, int height) {
+    if (!SDL_RenderTargetSupported(renderer)) return false;
+
+    if (!m_texture || width != m_width || height != m_height) {
+        free();
+        m_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width, height);
+        if (!m_texture) {
+            std::cerr << "Unable to create render cache: " << SDL_GetError() << std::endl;
+            return false;
+        }
+        SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+        m_width = width;
+        m_height = height;
+    }
+
+    m_previousTarget = SDL_GetRenderTarget(renderer);
+    if (SDL_SetRenderTarget(renderer, m_texture) != 0) {
+        return false;
+    }
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    return true;
+}
+
+void RenderCache::end(SDL_Renderer* renderer, Uint64 key) {
+    SDL_SetRenderTarget(renderer, m_previousTarget);
+    m_previousTarget = nullptr;
+    m_key = key;
+    m_valid = true;
+}
+
+void RenderCache::draw(SDL_Renderer* renderer, int x, int y) const {
+    if (!m_texture || !m_valid) return;
+    SDL_Rect destRect = {x, y, m_width, m_height};
+    SDL_RenderCopy(renderer, m_texture, nullptr, &destRect);
+    FrameCounters::addDrawCalls();
+}
@@ -0,0 +1,58 @@
+#ifndef RENDER_CACHE_H
+#define RENDER_CACHE_H
+
+#include <SDL2/SDL.h>
+
+// Offscreen render target that keeps a drawn layer between frames.
+// The owner computes a key from everything the layer depends on; the layer
+// is redrawn only when the key changes, and otherwise blitted as one copy.
+class RenderCache {
+public:
+    RenderCache();
+    ~RenderCache();
+
+    RenderCache(const RenderCache&) = delete;
+    RenderCache& operator=(const RenderCache&) = delete;
+
+    // True when the cached contents do not match key (or were never drawn)
+    bool needsRedraw(Uint64 key) const { return !m_valid || key != m_key; }
+
+    // Redirects drawing into the cache, cleared to transparent. Returns false
+    // if render targets are unavailable; the caller should draw directly instead.
+    bool begin(SDL_Renderer* renderer, int width, int height);
+    void end(SDL_Renderer* renderer, Uint64 key);
+
+    void draw(SDL_Renderer* renderer, int x, int y) const;
+
+    // Contents are lost (device reset) or stale; the next frame redraws
+    void invalidate() { m_valid = false; }
+    void free();
+
+private:
+    SDL_Texture* m_texture;
+    SDL_Texture* m_previousTarget;
+    int m_width;
+    int m_height;
+    Uint64 m_key;
+    bool m_valid;
+};
+
+// FNV-1a helpers for building cache keys
+namespace CacheKey {
+    const Uint64 SEED = 14695981039346656037ULL;
+
+    inline Uint64 mix(Uint64 hash, const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    template <typename T>
+    inline Uint64 mix(Uint64 hash, const T& value) {
+        return mix(hash, &value, sizeof(value));
+    }
+}
+
+#endif
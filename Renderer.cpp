@@ -2,6 +2,15 @@
 #include "Player.h"
 #include "Boss.h"
 #include "Sif.h"
+#include "FrameCounters.h"
+#include "Profiler.h"
+#include "TextureCache.h"
+#include "AssetBundle.h"
+#include "AttackTable.h"
+#include "ProjectilePool.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <sstream>
 #include <iomanip>
 #include <iostream>
@@ -10,15 +19,12 @@
 #define M_PI 3.14159265358979323846
 #endif
 
-// External AI pointer for debug access
-extern HolySwordWolfAI* g_sifAI;
+namespace {
+    // Bundle entry names for the two glyph atlases
+    const char* FONT_ATLAS_ENTRY = "glyphs/regular";
+    const char* SMALL_FONT_ATLAS_ENTRY = "glyphs/small";
 
-Renderer::Renderer(SDL_Renderer* renderer, int width, int height)
-    : m_renderer(renderer), m_screenWidth(width), m_screenHeight(height), m_debugMode(false), m_font(nullptr), m_smallFont(nullptr) {
-
-   
-
-    const char* fontPaths[] = {
+    const char* FONT_PATHS[] = {
         "assets/fonts/Montserrat/Montserrat-VariableFont_wght.ttf",  // Project fonts folder
         "fonts/arial.ttf",
         "arial.ttf",
@@ -27,25 +33,116 @@ Renderer::Renderer(SDL_Renderer* renderer, int width, int height)
         "C:/Windows/Fonts/arial.ttf",  // Windows
         nullptr
     };
-    
+
+    TTF_Font* openFontFromMemory(const std::vector<char>& data, int pointSize) {
+        if (data.empty()) return nullptr;
+        SDL_RWops* source = SDL_RWFromConstMem(data.data(), (int)data.size());
+        return source ? TTF_OpenFontRW(source, 1, pointSize) : nullptr;  // The font closes source
+    }
+
+    bool loadAtlas(GlyphAtlas& atlas, SDL_Renderer* renderer, const AssetBundle& bundle, const char* name) {
+        const AssetBundle::Entry* entry = bundle.find(name);
+        if (!entry || entry->kind != AssetBundle::Kind::GLYPH_ATLAS) return false;
+        return atlas.readMetrics(bundle.getMetrics(*entry), entry->metricsSize, entry->width, entry->height) &&
+               atlas.upload(renderer, bundle.getPixels(*entry), entry->pitch);
+    }
+
+    bool bakeAtlas(AssetBundleWriter& writer, TTF_Font* font, const char* name) {
+        GlyphAtlas atlas;
+        SDL_Surface* pixels = atlas.rasterize(font);
+        if (!pixels) return false;
+        std::vector<char> metrics;
+        atlas.writeMetrics(metrics);
+        writer.addGlyphAtlas(name, pixels, metrics);
+        SDL_FreeSurface(pixels);
+        return true;
+    }
+}
+
+Renderer::Renderer(SDL_Renderer* renderer, int width, int height)
+    : Renderer(renderer, width, height, nullptr, nullptr) {
+    openFonts(m_font, m_smallFont);
+    buildAtlases();
+}
+
+Renderer::Renderer(SDL_Renderer* renderer, int width, int height, TTF_Font* font, TTF_Font* smallFont)
+    : m_renderer(renderer), m_screenWidth(width), m_screenHeight(height), m_debugMode(false), m_font(font), m_smallFont(smallFont) {
+    buildAtlases();
+}
+
+Renderer::Renderer(SDL_Renderer* renderer, int width, int height, std::vector<char> fontData)
+    : Renderer(renderer, width, height, nullptr, nullptr) {
+    m_fontData.swap(fontData);
+    m_font = openFontFromMemory(m_fontData, 14);
+    m_smallFont = openFontFromMemory(m_fontData, 11);
+    if (!m_font || !m_smallFont) {
+        if (m_font) TTF_CloseFont(m_font);
+        if (m_smallFont) TTF_CloseFont(m_smallFont);
+        m_fontData.clear();
+        openFonts(m_font, m_smallFont);
+    }
+    buildAtlases();
+}
+
+bool Renderer::openFonts(TTF_Font*& font, TTF_Font*& smallFont) {
     // Try to load font from various paths
-    for (int i = 0; fontPaths[i] != nullptr; i++) {
-        m_font = TTF_OpenFont(fontPaths[i], 14);
-        m_smallFont = TTF_OpenFont(fontPaths[i], 11);
-        if (m_font && m_smallFont) {
-            std::cout << "Font loaded from: " << fontPaths[i] << std::endl;
-            break;
-        } else {
-            std::cerr << "Unable to open font from fontPaths. "<< TTF_GetError() << std::endl;
+    for (int i = 0; FONT_PATHS[i] != nullptr; i++) {
+        font = TTF_OpenFont(FONT_PATHS[i], 14);
+        smallFont = TTF_OpenFont(FONT_PATHS[i], 11);
+        if (font && smallFont) {
+            std::cout << "Font loaded from: " << FONT_PATHS[i] << std::endl;
+            return true;
         }
+        std::cerr << "Unable to open font from fontPaths. "<< TTF_GetError() << std::endl;
+        if (font) TTF_CloseFont(font);
+        if (smallFont) TTF_CloseFont(smallFont);
+        font = nullptr;
+        smallFont = nullptr;
     }
     
-    if (!m_font || !m_smallFont) {
-        std::cerr << "Failed to load font! Debug text will not be displayed properly." << std::endl;
+    std::cerr << "Failed to load font! Debug text will not be displayed properly." << std::endl;
+    return false;
+}
+
+bool Renderer::readFontFile(std::vector<char>& data) {
+    for (int i = 0; FONT_PATHS[i] != nullptr; i++) {
+        std::ifstream in(FONT_PATHS[i], std::ios::binary | std::ios::ate);
+        if (!in) continue;
+        std::streamoff size = in.tellg();
+        if (size <= 0) continue;
+        data.resize((size_t)size);
+        in.seekg(0);
+        if (in.read(data.data(), size)) return true;
     }
+    data.clear();
+    return false;
+}
+
+bool Renderer::loadGlyphAtlases(const AssetBundle& bundle) {
+    return loadAtlas(m_fontAtlas, m_renderer, bundle, FONT_ATLAS_ENTRY) &&
+           loadAtlas(m_smallFontAtlas, m_renderer, bundle, SMALL_FONT_ATLAS_ENTRY);
+}
+
+bool Renderer::bakeGlyphAtlases(AssetBundleWriter& writer) {
+    TTF_Font* font = nullptr;
+    TTF_Font* smallFont = nullptr;
+    if (!openFonts(font, smallFont)) return false;
+
+    bool baked = bakeAtlas(writer, font, FONT_ATLAS_ENTRY) && bakeAtlas(writer, smallFont, SMALL_FONT_ATLAS_ENTRY);
+    TTF_CloseFont(font);
+    TTF_CloseFont(smallFont);
+    return baked;
+}
+
+void Renderer::buildAtlases() {
+    // Build the glyph atlases once; drawText falls back to per-string TTF rendering without them
+    if (m_font) m_fontAtlas.build(m_renderer, m_font);
+    if (m_smallFont) m_smallFontAtlas.build(m_renderer, m_smallFont);
 }
 
 Renderer::~Renderer() {
+    m_fontAtlas.free();
+    m_smallFontAtlas.free();
     if (m_font) {
         TTF_CloseFont(m_font);
         m_font = nullptr;
@@ -62,24 +159,43 @@ void Renderer::clear() {
 }
 
 void Renderer::present() {
+    flushBatches();
     SDL_RenderPresent(m_renderer);
 }
 
+void Renderer::flushBatches() {
+    m_sprites.flush(m_renderer);
+    m_primitives.flush(m_renderer);
+}
+
+void Renderer::drawSprite(SDL_Texture* texture, int textureWidth, int textureHeight,
+                          const SDL_Rect& source, const SDL_Rect& dest, SDL_Color tint) {
+    // Shapes queued since the last sprite must land underneath this one
+    if (!m_primitives.empty()) flushBatches();
+    m_sprites.draw(texture, textureWidth, textureHeight, source, dest, tint);
+}
+
+void Renderer::drawTexture(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dst) {
+    flushBatches();
+    SDL_RenderCopy(m_renderer, texture, src, dst);
+    FrameCounters::addDrawCalls();
+}
+
 void Renderer::drawHealthBar(float x, float y, float width, float height, 
                            float percentage, SDL_Color color) {
     // Background
-    SDL_SetRenderDrawColor(m_renderer, 50, 50, 50, 255);
+    m_primitives.setColor(50, 50, 50);
     SDL_Rect bgRect = {(int)x, (int)y, (int)width, (int)height};
-    SDL_RenderFillRect(m_renderer, &bgRect);
+    m_primitives.fillRect(bgRect);
     
     // Health
-    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
+    m_primitives.setColor(color);
     SDL_Rect healthRect = {(int)x, (int)y, (int)(width * percentage), (int)height};
-    SDL_RenderFillRect(m_renderer, &healthRect);
+    m_primitives.fillRect(healthRect);
     
     // Border
-    SDL_SetRenderDrawColor(m_renderer, 255, 255, 255, 255);
-    SDL_RenderDrawRect(m_renderer, &bgRect);
+    m_primitives.setColor(255, 255, 255);
+    m_primitives.rect(bgRect);
 }
 
 void Renderer::drawStaminaBar(float x, float y, float width, float height, 
@@ -90,7 +206,7 @@ void Renderer::drawStaminaBar(float x, float y, float width, float height,
 
 void Renderer::drawTextFallback(const std::string& text, int x, int y, SDL_Color color) {
     // Enhanced fallback rendering with better character representation
-    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
+    m_primitives.setColor(color);
     
     int charWidth = 5;
     int charHeight = 8;
@@ -105,51 +221,59 @@ void Renderer::drawTextFallback(const std::string& text, int x, int y, SDL_Color
         // Draw a simple representation based on character type
         if (c >= '0' && c <= '9') {
             // Numbers - draw as filled rectangle
-            SDL_Rect charRect = {charX, y, charWidth, charHeight};
-            SDL_RenderFillRect(m_renderer, &charRect);
+            m_primitives.fillRect(SDL_Rect{charX, y, charWidth, charHeight});
         } else if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')) {
             // Letters - draw as outlined rectangle
-            SDL_Rect charRect = {charX, y, charWidth, charHeight};
-            SDL_RenderDrawRect(m_renderer, &charRect);
+            m_primitives.rect(SDL_Rect{charX, y, charWidth, charHeight});
         } else if (c == ':' || c == '|' || c == '!' || c == 'I' || c == 'l') {
             // Vertical characters - draw as vertical line
-            SDL_RenderDrawLine(m_renderer, charX + charWidth/2, y, charX + charWidth/2, y + charHeight);
+            m_primitives.line(charX + charWidth/2, y, charX + charWidth/2, y + charHeight);
         } else if (c == '-' || c == '_' || c == '=') {
             // Horizontal characters - draw as horizontal line
-            SDL_RenderDrawLine(m_renderer, charX, y + charHeight/2, charX + charWidth, y + charHeight/2);
+            m_primitives.line(charX, y + charHeight/2, charX + charWidth, y + charHeight/2);
         } else if (c == '.' || c == ',') {
             // Small punctuation - draw as small rect
-            SDL_Rect dotRect = {charX + charWidth/2 - 1, y + charHeight - 2, 2, 2};
-            SDL_RenderFillRect(m_renderer, &dotRect);
+            m_primitives.fillRect(SDL_Rect{charX + charWidth/2 - 1, y + charHeight - 2, 2, 2});
         } else if (c == '[' || c == ']' || c == '(' || c == ')') {
             // Brackets - draw as partial rectangles
             if (c == '[' || c == '(') {
-                SDL_RenderDrawLine(m_renderer, charX, y, charX, y + charHeight);
-                SDL_RenderDrawLine(m_renderer, charX, y, charX + 2, y);
-                SDL_RenderDrawLine(m_renderer, charX, y + charHeight, charX + 2, y + charHeight);
+                m_primitives.line(charX, y, charX, y + charHeight);
+                m_primitives.line(charX, y, charX + 2, y);
+                m_primitives.line(charX, y + charHeight, charX + 2, y + charHeight);
             } else {
-                SDL_RenderDrawLine(m_renderer, charX + charWidth, y, charX + charWidth, y + charHeight);
-                SDL_RenderDrawLine(m_renderer, charX + charWidth - 2, y, charX + charWidth, y);
-                SDL_RenderDrawLine(m_renderer, charX + charWidth - 2, y + charHeight, charX + charWidth, y + charHeight);
+                m_primitives.line(charX + charWidth, y, charX + charWidth, y + charHeight);
+                m_primitives.line(charX + charWidth - 2, y, charX + charWidth, y);
+                m_primitives.line(charX + charWidth - 2, y + charHeight, charX + charWidth, y + charHeight);
             }
         } else {
             // Default - draw as small filled rectangle
-            SDL_Rect charRect = {charX + 1, y + 1, charWidth - 2, charHeight - 2};
-            SDL_RenderFillRect(m_renderer, &charRect);
+            m_primitives.fillRect(SDL_Rect{charX + 1, y + 1, charWidth - 2, charHeight - 2});
         }
     }
 }
 
 void Renderer::drawText(const std::string& text, int x, int y, SDL_Color color) {
-    if (!m_font) {
+    // Use appropriate font based on text length or position
+    drawTextWithFont(text, x, y, color, text.length() > 30 || y > m_screenHeight - 100);
+}
+
+void Renderer::drawTextWithFont(const std::string& text, int x, int y, SDL_Color color, bool smallFont) {
+    // Atlases loaded from a bundle work without any font open
+    bool useSmall = smallFont && (m_smallFont || m_smallFontAtlas.isReady());
+    GlyphAtlas& atlas = useSmall ? m_smallFontAtlas : m_fontAtlas;
+    if (atlas.isReady()) {
+        flushBatches();
+        atlas.drawText(m_renderer, text, x, y, color);
+        FrameCounters::addDrawCalls();
+        return;
+    }
+
+    TTF_Font* fontToUse = useSmall ? m_smallFont : m_font;
+    if (!fontToUse) {
         drawTextFallback(text, x, y, color);
         return;
     }
     
-    // Use appropriate font based on text length or position
-    TTF_Font* fontToUse = (text.length() > 30 || y > m_screenHeight - 100) ? m_smallFont : m_font;
-    if (!fontToUse) fontToUse = m_font;  // Fallback to main font if small font failed
-    
     // Render text to surface
     SDL_Surface* textSurface = TTF_RenderText_Blended(fontToUse, text.c_str(), color);
     if (!textSurface) {
@@ -174,7 +298,7 @@ void Renderer::drawText(const std::string& text, int x, int y, SDL_Color color)
     SDL_Rect destRect = {x, y, textWidth, textHeight};
     
     // Render the text texture
-    SDL_RenderCopy(m_renderer, textTexture, nullptr, &destRect);
+    drawTexture(textTexture, nullptr, &destRect);
     
     // Clean up
     SDL_FreeSurface(textSurface);
@@ -182,48 +306,85 @@ void Renderer::drawText(const std::string& text, int x, int y, SDL_Color color)
 }
 
 void Renderer::drawRect(int x, int y, int w, int h, SDL_Color color, bool filled) {
-    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
+    m_primitives.setColor(color);
     SDL_Rect rect = {x, y, w, h};
     if (filled) {
-        SDL_RenderFillRect(m_renderer, &rect);
+        m_primitives.fillRect(rect);
     } else {
-        SDL_RenderDrawRect(m_renderer, &rect);
+        m_primitives.rect(rect);
     }
 }
 
 void Renderer::drawEntity(const SDL_Rect& rect, SDL_Color color) {
-    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
-    SDL_RenderFillRect(m_renderer, &rect);
+    m_primitives.setColor(color);
+    m_primitives.fillRect(rect);
 }
 
-void Renderer::drawUI(const Player* player, const Boss* boss) {
-    // Player health bar
-    drawHealthBar(20, m_screenHeight - 50, 200, 20, 
-                 player->getHealthPercentage(), {0, 255, 0, 255});
-    
-    // Player stamina bar
-    drawStaminaBar(20, m_screenHeight - 25, 200, 15, 
-                  player->getStaminaPercentage());
+void Renderer::drawUI(const Player* player, const Boss* boss, const HolySwordWolfAI* ai) {
+    // Player health and stamina bars, keyed on their filled widths in pixels
+    const int playerBarsX = 20;
+    const int playerBarsY = m_screenHeight - 50;
+    Uint64 playerKey = CacheKey::mix(CacheKey::SEED, (int)(200 * player->getHealthPercentage()));
+    playerKey = CacheKey::mix(playerKey, (int)(200 * player->getStaminaPercentage()));
+    flushBatches();  // Cached layers switch render targets and draw textures
+    if (m_playerBarsCache.needsRedraw(playerKey)) {
+        if (m_playerBarsCache.begin(m_renderer, 201, 46)) {
+            drawPlayerBars(player, 0, 0);
+            flushBatches();
+            m_playerBarsCache.end(m_renderer, playerKey);
+        } else {
+            drawPlayerBars(player, playerBarsX, playerBarsY);
+            flushBatches();
+        }
+    }
+    m_playerBarsCache.draw(m_renderer, playerBarsX, playerBarsY);
     
     // Boss health bar
-    drawHealthBar((float)m_screenWidth/2 - 150, 20, 300, 30, 
-                 boss->getHealthPercentage(), {255, 0, 0, 255});
+    const int bossBarX = m_screenWidth / 2 - 150;
+    const int bossBarY = 20;
+    Uint64 bossKey = CacheKey::mix(CacheKey::SEED, (int)(300 * boss->getHealthPercentage()));
+    if (m_bossBarCache.needsRedraw(bossKey)) {
+        if (m_bossBarCache.begin(m_renderer, 301, 31)) {
+            drawHealthBar(0, 0, 300, 30, boss->getHealthPercentage(), {255, 0, 0, 255});
+            flushBatches();
+            m_bossBarCache.end(m_renderer, bossKey);
+        } else {
+            drawHealthBar(bossBarX, bossBarY, 300, 30, boss->getHealthPercentage(), {255, 0, 0, 255});
+            flushBatches();
+        }
+    }
+    m_bossBarCache.draw(m_renderer, bossBarX, bossBarY);
     
     // Debug mode indicator
     if (m_debugMode) {
-        SDL_SetRenderDrawColor(m_renderer, 255, 0, 0, 255);
-        SDL_Rect debugRect = {10, 70, 150, 20};
-        SDL_RenderDrawRect(m_renderer, &debugRect);
+        m_primitives.setColor(255, 0, 0);
+        m_primitives.rect(SDL_Rect{10, 70, 150, 20});
     }
 
     // AI Debug display
     if (m_debugMode && m_showAIDebug) {
-        drawAIDebugInfo();
+        drawAIDebugInfo(ai);
     }
 }
 
+void Renderer::drawPlayerBars(const Player* player, int left, int top) {
+    // Player health bar
+    drawHealthBar(left, top, 200, 20, 
+                 player->getHealthPercentage(), {0, 255, 0, 255});
+    
+    // Player stamina bar
+    drawStaminaBar(left, top + 25, 200, 15, 
+                  player->getStaminaPercentage());
+}
+
+void Renderer::invalidateCaches() {
+    m_playerBarsCache.invalidate();
+    m_bossBarCache.invalidate();
+    m_aiPanelCache.invalidate();
+}
+
 void Renderer::drawCircle(int centerX, int centerY, int radius, SDL_Color color) {
-    SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
+    m_primitives.setColor(color);
     int x = radius - 1;
     int y = 0;
     int tx = 1;
@@ -231,14 +392,14 @@ void Renderer::drawCircle(int centerX, int centerY, int radius, SDL_Color color)
     int err = tx - (radius << 1);
 
     while (x >= y) {
-        SDL_RenderDrawPoint(m_renderer, centerX + x, centerY - y);
-        SDL_RenderDrawPoint(m_renderer, centerX + x, centerY + y);
-        SDL_RenderDrawPoint(m_renderer, centerX - x, centerY - y);
-        SDL_RenderDrawPoint(m_renderer, centerX - x, centerY + y);
-        SDL_RenderDrawPoint(m_renderer, centerX + y, centerY - x);
-        SDL_RenderDrawPoint(m_renderer, centerX + y, centerY + x);
-        SDL_RenderDrawPoint(m_renderer, centerX - y, centerY - x);
-        SDL_RenderDrawPoint(m_renderer, centerX - y, centerY + x);
+        m_primitives.point(centerX + x, centerY - y);
+        m_primitives.point(centerX + x, centerY + y);
+        m_primitives.point(centerX - x, centerY - y);
+        m_primitives.point(centerX - x, centerY + y);
+        m_primitives.point(centerX + y, centerY - x);
+        m_primitives.point(centerX + y, centerY + x);
+        m_primitives.point(centerX - y, centerY - x);
+        m_primitives.point(centerX - y, centerY + x);
 
         if (err <= 0) {
             y++;
@@ -254,18 +415,38 @@ void Renderer::drawCircle(int centerX, int centerY, int radius, SDL_Color color)
     }
 }
 
+void Renderer::drawProjectiles(const ProjectilePool& projectiles) {
+    const float* xs = projectiles.getPositionsX();
+    const float* ys = projectiles.getPositionsY();
+    const ProjectileOwner* owners = projectiles.getOwners();
+    int size = (int)GameUnits::toPixels(ProjectilePool::RADIUS * 2.0f);
+
+    // One batched quad per shot, so a barrage costs a single draw call
+    for (int i = 0; i < projectiles.size(); ++i) {
+        if (owners[i] == ProjectileOwner::BOSS) {
+            m_primitives.setColor(120, 200, 255);  // Sif's magic
+        } else {
+            m_primitives.setColor(255, 220, 120);
+        }
+        SDL_Rect rect = {
+            (int)GameUnits::toPixels(xs[i]) - size / 2,
+            (int)GameUnits::toPixels(ys[i]) - size / 2,
+            size, size
+        };
+        m_primitives.fillRect(rect);
+    }
+}
+
 void Renderer::drawDebugInfo(const Player* player, const Boss* boss) {
     if (!m_debugMode) return;
 
     // Draw collision boxes (already in pixels)
-    SDL_SetRenderDrawColor(m_renderer, 255, 255, 0, 255);  // Yellow for collision boxes
-    SDL_Rect playerBox = player->getCollisionBox();
-    SDL_Rect bossBox = boss->getCollisionBox();
-    SDL_RenderDrawRect(m_renderer, &playerBox);
-    SDL_RenderDrawRect(m_renderer, &bossBox);
+    m_primitives.setColor(255, 255, 0);  // Yellow for collision boxes
+    m_primitives.rect(player->getCollisionBox());
+    m_primitives.rect(boss->getCollisionBox());
 
     // Draw player attack range (convert meters to pixels)
-    SDL_SetRenderDrawColor(m_renderer, 255, 255, 0, 100);  // Yellow for player attack range
+    // Yellow for player attack range
     Vector2D playerPosPixels = GameUnits::toPixels(player->getPosition());
     int playerX = static_cast<int>(playerPosPixels.x);
     int playerY = static_cast<int>(playerPosPixels.y);
@@ -273,7 +454,7 @@ void Renderer::drawDebugInfo(const Player* player, const Boss* boss) {
     drawCircle(playerX, playerY, playerAttackRangePixels, {255, 255, 0, 100});
 
     // Draw boss attack range (convert meters to pixels)
-    SDL_SetRenderDrawColor(m_renderer, 255, 0, 0, 100);  // Red for boss attack range
+    // Red for boss attack range
     Vector2D bossPosPixels = GameUnits::toPixels(boss->getPosition());
     int bossX = static_cast<int>(bossPosPixels.x);
     int bossY = static_cast<int>(bossPosPixels.y);
@@ -282,7 +463,7 @@ void Renderer::drawDebugInfo(const Player* player, const Boss* boss) {
 
     // Draw boss attack hitbox when attacking (convert meters to pixels)
     if (boss->isAttacking()) {
-        SDL_SetRenderDrawColor(m_renderer, 255, 0, 255, 255);  // Magenta for active attack
+        // Magenta for active attack
         Circle attackCircle = boss->getAttackCircle();
         Vector2D attackCenterPixels = GameUnits::toPixels(Vector2D(attackCircle.x, attackCircle.y));
         int attackX = static_cast<int>(attackCenterPixels.x);
@@ -290,9 +471,8 @@ void Renderer::drawDebugInfo(const Player* player, const Boss* boss) {
         int attackRadiusPixels = static_cast<int>(GameUnits::toPixels(attackCircle.r));
         drawCircle(attackX, attackY, attackRadiusPixels, {255, 0, 255, 255});
         
-        SDL_SetRenderDrawColor(m_renderer, 200, 200, 255, 255);  // Light blue for sword
-        SDL_Rect swordBox = boss->getSwordHitbox();
-        SDL_RenderDrawRect(m_renderer, &swordBox);
+        m_primitives.setColor(200, 200, 255);  // Light blue for sword
+        m_primitives.rect(boss->getSwordHitbox());
     }
 
     // Draw boss state indicator (convert position to pixels, keep offsets in pixels)
@@ -312,80 +492,107 @@ void Renderer::drawDebugInfo(const Player* player, const Boss* boss) {
     // Draw attack type indicator when attacking (convert position to pixels, keep offsets in pixels)
     if (animState == BossAnimState::ATTACKING) {
         BossAttackAnim attackAnim = boss->getCurrentAttackAnim();
-        SDL_Color attackColor;
-        switch (attackAnim) {
-            case BossAttackAnim::HORIZONTAL_SWING: attackColor = {173, 216, 230, 255}; break; // Light Blue
-            case BossAttackAnim::SPIN_ATTACK: attackColor = {0, 255, 255, 255}; break;       // Cyan
-            case BossAttackAnim::OVERHEAD_SWING: attackColor = {255, 0, 255, 255}; break;    // Magenta
-            case BossAttackAnim::UPPERCUT: attackColor = {255, 165, 0, 255}; break;          // Orange
-            case BossAttackAnim::GROUND_SLAM: attackColor = {165, 42, 42, 255}; break;       // Brown
-            case BossAttackAnim::DASH_ATTACK: attackColor = {255, 192, 203, 255}; break;     // Pink
-            case BossAttackAnim::PROJECTILE: attackColor = {0, 255, 0, 255}; break;          // Lime
-            case BossAttackAnim::BACKSTEP_SLASH: attackColor = {0, 128, 128, 255}; break;    // Teal
-            default: attackColor = {255, 255, 255, 255}; break;                              // White
-        }
+        SDL_Color attackColor = AttackTable::anim(attackAnim).debugColor;
         drawCircle(bossX + 10, bossY - 40, 5, attackColor);
     }
 
     // Draw player attack hitbox if attacking (already in pixels)
     if (player->isAttacking()) {
-        SDL_SetRenderDrawColor(m_renderer, 0, 255, 255, 255);  // Cyan
-        SDL_Rect playerSwordBox = player->getSwordHitbox();
-        SDL_RenderDrawRect(m_renderer, &playerSwordBox);
+        m_primitives.setColor(0, 255, 255);  // Cyan
+        m_primitives.rect(player->getSwordHitbox());
     }
 }
 
-void Renderer::drawAIDebugInfo() {
-    if (!g_sifAI || !g_sifAI->isDebugEnabled()) return;
-    
+void Renderer::drawAIDebugInfo(const HolySwordWolfAI* ai) {
+    if (!ai || !ai->isDebugEnabled()) return;
+
+    const int panelX = m_screenWidth - 350;
+    const int panelY = 100;
+    SDL_Color stateColor = {255, 255, 0, 255};
+
+    // Key on everything the cached panel shows; it changes when goals are picked or finish
+    Uint64 key = CacheKey::SEED;
+    key = CacheKey::mix(key, ai->isEnhanced());
+    key = CacheKey::mix(key, ai->getAggressionLevel());
+    const std::string& currentGoal = ai->getCurrentGoalDebug();
+    key = CacheKey::mix(key, currentGoal.data(), currentGoal.size());
+    for (const auto& goal : ai->getGoalQueueDebug()) {
+        key = CacheKey::mix(key, goal.data(), goal.size() + 1);  // Include the terminator as a separator
+    }
+    const auto& history = ai->getGoalHistory();
+    int historyCount = 0;
+    for (auto it = history.rbegin(); it != history.rend() && historyCount < 5; ++it, ++historyCount) {
+        key = CacheKey::mix(key, it->timestamp);
+        key = CacheKey::mix(key, it->goalName.data(), it->goalName.size() + 1);
+        key = CacheKey::mix(key, it->reason.data(), it->reason.size() + 1);
+    }
+
+    flushBatches();
+    if (m_aiPanelCache.needsRedraw(key)) {
+        if (m_aiPanelCache.begin(m_renderer, 340, m_screenHeight - panelY - 10)) {
+            drawAIDebugPanel(ai, 0, 0);
+            flushBatches();
+            m_aiPanelCache.end(m_renderer, key);
+        } else {
+            drawAIDebugPanel(ai, panelX, panelY);
+            flushBatches();
+        }
+    }
+    m_aiPanelCache.draw(m_renderer, panelX, panelY);
+
+    // The cooldown ticks every frame, so it is drawn live over the cached panel
+    char cooldown[32];
+    snprintf(cooldown, sizeof(cooldown), "Cooldown: %.2f", ai->getActionCooldown());
+    drawText(cooldown, panelX + 10, panelY + 60, stateColor);
+}
+
+void Renderer::drawAIDebugPanel(const HolySwordWolfAI* ai, int left, int top) {
     // Background panel for AI debug info
     SDL_Color bgColor = {0, 0, 0, 200};
-    drawRect(m_screenWidth - 350, 100, 340, 400, bgColor, true);
+    drawRect(left, top, 340, 400, bgColor, true);
     
     // Title
     SDL_Color titleColor = {255, 255, 255, 255};
-    drawText("===  AI DEBUG INFO  ===", m_screenWidth - 340, 110, titleColor);
+    drawText("===  AI DEBUG INFO  ===", left + 10, top + 10, titleColor);
     
-    int yPos = 130;
+    int yPos = top + 30;
     
     // AI State
     SDL_Color stateColor = {255, 255, 0, 255};
     std::stringstream ss;
-    ss << "Enhanced: " << (g_sifAI->isEnhanced() ? "YES" : "NO");
-    drawText(ss.str(), m_screenWidth - 340, yPos, stateColor);
+    ss << "Enhanced: " << (ai->isEnhanced() ? "YES" : "NO");
+    drawText(ss.str(), left + 10, yPos, stateColor);
     yPos += 15;
     
     ss.str("");
-    ss << "Aggression: " << g_sifAI->getAggressionLevel();
-    drawText(ss.str(), m_screenWidth - 340, yPos, stateColor);
+    ss << "Aggression: " << ai->getAggressionLevel();
+    drawText(ss.str(), left + 10, yPos, stateColor);
     yPos += 15;
     
-    ss.str("");
-    ss << "Cooldown: " << std::fixed << std::setprecision(2) << g_sifAI->getActionCooldown();
-    drawText(ss.str(), m_screenWidth - 340, yPos, stateColor);
+    // Cooldown line is drawn live by drawAIDebugInfo
     yPos += 20;
     
     // Current Goal
     SDL_Color currentColor = {0, 255, 0, 255};
-    drawText("CURRENT GOAL:", m_screenWidth - 340, yPos, currentColor);
+    drawText("CURRENT GOAL:", left + 10, yPos, currentColor);
     yPos += 15;
-    drawText(g_sifAI->getCurrentGoalDebug(), m_screenWidth - 330, yPos, currentColor);
+    drawText(ai->getCurrentGoalDebug(), left + 20, yPos, currentColor);
     yPos += 20;
     
     // Goal Queue
     SDL_Color queueColor = {100, 200, 255, 255};
-    drawText("GOAL QUEUE:", m_screenWidth - 340, yPos, queueColor);
+    drawText("GOAL QUEUE:", left + 10, yPos, queueColor);
     yPos += 15;
     
-    const auto& goalQueue = g_sifAI->getGoalQueueDebug();
+    const auto& goalQueue = ai->getGoalQueueDebug();
     if (goalQueue.empty()) {
-        drawText("  [Empty]", m_screenWidth - 330, yPos, queueColor);
+        drawText("  [Empty]", left + 20, yPos, queueColor);
         yPos += 15;
     } else {
         for (const auto& goal : goalQueue) {
-            drawText("  " + goal, m_screenWidth - 330, yPos, queueColor);
+            drawText("  " + goal, left + 20, yPos, queueColor);
             yPos += 15;
-            if (yPos > 350) break; // Don't overflow the panel
+            if (yPos > top + 250) break; // Don't overflow the panel
         }
     }
     
@@ -393,25 +600,134 @@ void Renderer::drawAIDebugInfo() {
     
     // Recent Goal History
     SDL_Color historyColor = {255, 150, 100, 255};
-    drawText("RECENT GOALS:", m_screenWidth - 340, yPos, historyColor);
+    drawText("RECENT GOALS:", left + 10, yPos, historyColor);
     yPos += 15;
     
-    const auto& history = g_sifAI->getGoalHistory();
+    const auto& history = ai->getGoalHistory();
     int historyCount = 0;
     for (auto it = history.rbegin(); it != history.rend() && historyCount < 5; ++it, ++historyCount) {
         ss.str("");
         ss << "  " << std::fixed << std::setprecision(1) << it->timestamp << "s: " << it->goalName;
-        drawText(ss.str(), m_screenWidth - 330, yPos, historyColor);
+        drawText(ss.str(), left + 20, yPos, historyColor);
         yPos += 13;
         
-        drawText("    -> " + it->reason, m_screenWidth - 320, yPos, {200, 150, 100, 255});
+        drawText("    -> " + it->reason, left + 30, yPos, {200, 150, 100, 255});
         yPos += 15;
         
-        if (yPos > 480) break; // Don't overflow the panel
+        if (yPos > top + 380) break; // Don't overflow the panel
     }
     
-    // Instructions
+    // Instructions, pinned to the bottom of the screen in the small font
     SDL_Color instructionColor = {150, 150, 150, 255};
-    drawText("Ctrl+D: Toggle Debug", m_screenWidth - 340, m_screenHeight - 40, instructionColor);
-    drawText("Ctrl+E: Toggle Enhanced", m_screenWidth - 340, m_screenHeight - 25, instructionColor);
+    int instructionsY = top + (m_screenHeight - 100) - 55;
+    drawTextWithFont("Ctrl+P: Toggle Perf HUD", left + 10, instructionsY, instructionColor, true);
+    drawTextWithFont("Ctrl+D: Toggle Debug", left + 10, instructionsY + 15, instructionColor, true);
+    drawTextWithFont("Ctrl+E: Toggle Enhanced", left + 10, instructionsY + 30, instructionColor, true);
+}
+
+void Renderer::drawSmallText(const std::string& text, int x, int y, SDL_Color color) {
+    if (m_smallFontAtlas.isReady()) {
+        flushBatches();
+        m_smallFontAtlas.drawText(m_renderer, text, x, y, color);
+        FrameCounters::addDrawCalls();
+    } else {
+        // The fallback font has no line breaks of its own
+        std::istringstream lines(text);
+        std::string line;
+        for (int lineY = y; std::getline(lines, line); lineY += 12) {
+            drawTextFallback(line, x, lineY, color);
+        }
+    }
+}
+
+void Renderer::drawPerfHUD(const Profiler& profiler, const TextureCache* textures) {
+    if (!m_showPerfHUD) return;
+
+    // Keep the overlay's own draw calls and allocations out of the numbers it shows
+    FrameCounters::ScopedPause pauseCounters;
+
+    const int firstPhase = static_cast<int>(ProfilePhase::HANDLE_EVENTS);
+    const int phaseCount = static_cast<int>(ProfilePhase::COUNT) - firstPhase;
+    const int padding = 6;
+    const int graphWidth = Profiler::WINDOW_FRAMES;
+    const int graphHeight = 80;
+    const float graphMaxMs = 1000.0f / 30.0f;   // Top of the graph is a 30 FPS frame
+    const float barMaxMs = 1000.0f / 60.0f;     // A full bar is a whole 60 FPS frame
+    const int labelWidth = 100;
+    const int lineSkip = m_smallFontAtlas.isReady() ? m_smallFontAtlas.getLineSkip()
+                       : m_smallFont ? TTF_FontLineSkip(m_smallFont) : 12;
+
+    const int panelX = 10;
+    const int panelY = 100;
+    const int readoutY = panelY + padding;
+    const int graphY = readoutY + 3 * lineSkip + padding;
+    const int barsY = graphY + graphHeight + padding;
+    const int panelWidth = graphWidth + 2 * padding;
+    const int panelHeight = barsY + phaseCount * lineSkip + padding - panelY;
+    const int graphX = panelX + padding;
+
+    // Labels never change; the readout text is refreshed four times a second at 60 FPS
+    if (m_hudLabels.empty()) {
+        for (int phase = firstPhase; phase < static_cast<int>(ProfilePhase::COUNT); ++phase) {
+            if (!m_hudLabels.empty()) m_hudLabels += "\n";
+            m_hudLabels += Profiler::phaseName(static_cast<ProfilePhase>(phase));
+        }
+    }
+    if (--m_hudRefreshCountdown <= 0) {
+        PhaseStats frameStats = profiler.getStats(ProfilePhase::FRAME);
+        char readout[160];
+        snprintf(readout, sizeof(readout),
+                 "Frame %.2f ms  avg %.2f  p99 %.2f  max %.2f\nDraw calls %lld  Allocations %lld",
+                 profiler.getLastFrameMs(ProfilePhase::FRAME), frameStats.avgMs, frameStats.p99Ms,
+                 frameStats.maxMs, profiler.getLastDrawCalls(), profiler.getLastAllocations());
+        m_hudReadout = readout;
+        if (textures) {
+            snprintf(readout, sizeof(readout), "\nTextures %d  %.1f / %.0f MB", (int)textures->getTextureCount(),
+                     textures->getUsedBytes() / (1024.0 * 1024.0), textures->getBudget() / (1024.0 * 1024.0));
+            m_hudReadout += readout;
+        }
+        m_hudRefreshCountdown = 15;
+    }
+
+    // Panel and graph background
+    SDL_SetRenderDrawBlendMode(m_renderer, SDL_BLENDMODE_BLEND);
+    m_primitives.setColor(0, 0, 0, 190);
+    m_primitives.fillRect(SDL_Rect{panelX, panelY, panelWidth, panelHeight});
+    m_primitives.fillRect(SDL_Rect{graphX, graphY, graphWidth, graphHeight});
+
+    // 60 and 120 FPS guide lines
+    const float guideMs[2] = {1000.0f / 60.0f, 1000.0f / 120.0f};
+    m_primitives.setColor(80, 80, 80);
+    for (int i = 0; i < 2; ++i) {
+        int guideY = graphY + graphHeight - (int)(guideMs[i] / graphMaxMs * graphHeight);
+        m_primitives.line(graphX, guideY, graphX + graphWidth - 1, guideY);
+    }
+
+    // Frame-time graph, newest frame on the right; the batch joins the segments into one polyline
+    int frames = profiler.getWindowSize();
+    m_primitives.setColor(0, 255, 120);
+    SDL_Point previous = {0, 0};
+    for (int i = 0; i < frames; ++i) {
+        float ms = std::min((float)profiler.getFrameMs(ProfilePhase::FRAME, frames - 1 - i), graphMaxMs);
+        SDL_Point point = {graphX + graphWidth - frames + i,
+                           graphY + graphHeight - 1 - (int)(ms / graphMaxMs * (graphHeight - 1))};
+        if (i > 0) m_primitives.line(previous.x, previous.y, point.x, point.y);
+        previous = point;
+    }
+
+    // Per-phase bars for the last frame: update phases in blue, the rest in orange
+    const int barX = graphX + labelWidth;
+    const int barMaxWidth = graphWidth - labelWidth;
+    for (int i = 0; i < phaseCount; ++i) {
+        ProfilePhase phase = static_cast<ProfilePhase>(firstPhase + i);
+        float ms = std::min((float)profiler.getLastFrameMs(phase), barMaxMs);
+        SDL_Rect bar = {barX, barsY + i * lineSkip + 2, std::max(1, (int)(ms / barMaxMs * barMaxWidth)), lineSkip - 4};
+        bool isUpdate = phase == ProfilePhase::UPDATE || phase == ProfilePhase::UPDATE_AI ||
+                        phase == ProfilePhase::UPDATE_ENTITIES || phase == ProfilePhase::UPDATE_COLLISION;
+        m_primitives.setColor(isUpdate ? SDL_Color{80, 160, 255, 255} : SDL_Color{255, 160, 60, 255});
+        m_primitives.fillRect(bar);
+    }
+
+    drawSmallText(m_hudReadout, graphX, readoutY, {255, 255, 255, 255});
+    drawSmallText(m_hudLabels, graphX, barsY, {200, 200, 200, 255});
 }
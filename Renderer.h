@@ -4,9 +4,20 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <string>
+#include <vector>
+#include "GlyphAtlas.h"
+#include "PrimitiveBatch.h"
+#include "RenderCache.h"
+#include "SpriteBatch.h"
 
 class Player;
 class Boss;
+class HolySwordWolfAI;
+class Profiler;
+class TextureCache;
+class AssetBundle;
+class AssetBundleWriter;
+class ProjectilePool;
 
 class Renderer {
 private:
@@ -15,22 +26,63 @@ private:
     int m_screenHeight;
     bool m_debugMode;  // Toggle with D key
     bool m_showAIDebug = true;  // Toggle AI debug specifically
+    bool m_showPerfHUD = false;  // Toggle with Ctrl+P
+
+    // Performance HUD text
+    std::string m_hudLabels;    // Phase names, one per line
+    std::string m_hudReadout;   // Frame time and counters, refreshed a few times a second
+    int m_hudRefreshCountdown = 0;
 
     // Font for text rendering
     TTF_Font* m_font;
     TTF_Font* m_smallFont;
+    std::vector<char> m_fontData;  // File the fonts were opened from, if from memory; SDL_ttf reads it lazily
+    GlyphAtlas m_fontAtlas;
+    GlyphAtlas m_smallFontAtlas;
+
+    // Retained layers, redrawn only when what they show changes
+    RenderCache m_playerBarsCache;
+    RenderCache m_bossBarCache;
+    RenderCache m_aiPanelCache;
+
+    // Sprites and shapes queued this frame. Queued sprites are always older than
+    // queued shapes, so flushing sprites then shapes keeps submission order.
+    SpriteBatch m_sprites;
+    PrimitiveBatch m_primitives;
 
-    // Text rendering helper (simple method)
-    void drawText(const std::string& text, int x, int y, SDL_Color color);
     void drawTextFallback(const std::string& text, int x, int y, SDL_Color color);
     void drawRect(int x, int y, int w, int h, SDL_Color color, bool filled = false);
+    void drawSmallText(const std::string& text, int x, int y, SDL_Color color);
+    void drawTextWithFont(const std::string& text, int x, int y, SDL_Color color, bool smallFont);
+    void drawPlayerBars(const Player* player, int left, int top);
+    void drawAIDebugPanel(const HolySwordWolfAI* ai, int left, int top);
+    void buildAtlases();
     
 public:
     Renderer(SDL_Renderer* renderer, int width, int height);
+    // Takes ownership of fonts opened elsewhere (either may be null)
+    Renderer(SDL_Renderer* renderer, int width, int height, TTF_Font* font, TTF_Font* smallFont);
+    // Opens the fonts from a file already in memory (see readFontFile), probing the paths if that fails
+    Renderer(SDL_Renderer* renderer, int width, int height, std::vector<char> fontData);
+
+    // Probes the known font locations with TTF_OpenFont; main thread only
+    static bool openFonts(TTF_Font*& font, TTF_Font*& smallFont);
+    // Reads the first font file found at the known locations; plain file I/O, so it may run on a worker thread
+    static bool readFontFile(std::vector<char>& data);
+
+    // Glyph atlases pre-rasterised into an asset bundle, so no font needs opening at startup
+    bool loadGlyphAtlases(const AssetBundle& bundle);
+    static bool bakeGlyphAtlases(AssetBundleWriter& writer);
     ~Renderer(); 
 
     void clear();
     void present();
+
+    PrimitiveBatch& primitives() { return m_primitives; }
+    void flushBatches();
+    void drawTexture(SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dst);
+    void drawSprite(SDL_Texture* texture, int textureWidth, int textureHeight,
+                    const SDL_Rect& source, const SDL_Rect& dest, SDL_Color tint);
     
     void drawHealthBar(float x, float y, float width, float height, 
                       float percentage, SDL_Color color);
@@ -38,14 +90,20 @@ public:
                        float percentage);
     void drawEntity(const SDL_Rect& rect, SDL_Color color);
     void drawCircle(int centerX, int centerY, int radius, SDL_Color color);
-    void drawUI(const Player* player, const Boss* boss);
+    void drawText(const std::string& text, int x, int y, SDL_Color color);
+    void drawProjectiles(const ProjectilePool& projectiles);
+    void drawUI(const Player* player, const Boss* boss, const HolySwordWolfAI* ai);
     void drawDebugInfo(const Player* player, const Boss* boss);
-    void drawAIDebugInfo();
+    void drawAIDebugInfo(const HolySwordWolfAI* ai);
+    void drawPerfHUD(const Profiler& profiler, const TextureCache* textures = nullptr);
+    void invalidateCaches();  // After a render target or device reset
     
     void toggleDebugMode() { m_debugMode = !m_debugMode; }
     void toggleAIDebug() { m_showAIDebug = !m_showAIDebug; }
+    void togglePerfHUD() { m_showPerfHUD = !m_showPerfHUD; }
     bool isDebugMode() const { return m_debugMode; }
     bool isAIDebugMode() const { return m_showAIDebug; }
+    bool isPerfHUDVisible() const { return m_showPerfHUD; }
 };
 
 #endif
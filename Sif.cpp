@@ -1,60 +1,20 @@
 #include "Sif.h"
 #include "Vector2D.h"
+#include "Trace.h"
+#include "AttackTable.h"
 #include <random>
 #include <iostream>
 #include <iomanip>
 
-HolySwordWolfAI* g_sifAI = nullptr;
-
 // Updated Goal implementations to work with Boss
 void AttackGoal::activate(HolySwordWolfAI* ai) {
     currentTime = 0;
     
-    // Map AttackType to BossAttackAnim
-    BossAttackAnim bossAnim;
-    switch (attackType) {
-        case AttackType::LIGHT_COMBO_1:
-        case AttackType::LIGHT_COMBO_2:
-        case AttackType::LIGHT_COMBO_3:
-        case AttackType::ENHANCED_COMBO_1:
-            bossAnim = BossAttackAnim::HORIZONTAL_SWING;
-            break;
-            
-        case AttackType::SPIN_ATTACK:
-        case AttackType::ENHANCED_SPIN_R:
-        case AttackType::ENHANCED_SPIN_L:
-            bossAnim = BossAttackAnim::SPIN_ATTACK;
-            break;
-            
-        case AttackType::UPPERCUT:
-            bossAnim = BossAttackAnim::UPPERCUT;
-            break;
-            
-        case AttackType::BACKSTEP_SLASH_R:
-        case AttackType::BACKSTEP_SLASH_L:
-            bossAnim = BossAttackAnim::BACKSTEP_SLASH;
-            break;
-            
-        case AttackType::GROUND_SLAM:
-        case AttackType::GROUND_SLAM_FOLLOWUP:
-        case AttackType::ENHANCED_COMBO_2:
-            bossAnim = BossAttackAnim::GROUND_SLAM;
-            break;
-            
-        case AttackType::DASH_ATTACK:
-        case AttackType::DASH_FOLLOWUP:
-            bossAnim = BossAttackAnim::DASH_ATTACK;
-            break;
-            
-        case AttackType::PROJECTILE:
-            bossAnim = BossAttackAnim::PROJECTILE;
-            break;
-            
-        default:
-            bossAnim = BossAttackAnim::HORIZONTAL_SWING;
-            break;
-    }
+    // Unknown types fall back to a plain swing
+    BossAttackAnim bossAnim = AttackTable::isKnown(attackType) ? AttackTable::attack(attackType).anim
+                                                              : BossAttackAnim::HORIZONTAL_SWING;
     
+    ai->m_attackCounts[attackType]++;
     ai->m_self->startAttackAnimation(bossAnim);
 }
 
@@ -84,6 +44,8 @@ void AttackGoal::terminate(HolySwordWolfAI* ai) {
 }
 
 void MoveToTargetGoal::activate(HolySwordWolfAI* ai) {
+    lastTargetPos = ai->m_target->getPosition();
+
     // Calculate target position based on desired distance
     Vector2D toTarget = ai->m_target->getPosition() - ai->m_self->getPosition();
     float currentDist = toTarget.length();
@@ -122,9 +84,7 @@ bool MoveToTargetGoal::update(HolySwordWolfAI* ai, float deltaTime) {
     }
     
     // Only recalculate if target moved significantly
-    static Vector2D lastTargetPos = ai->m_target->getPosition();
     if (lastTargetPos.distance(ai->m_target->getPosition()) > 2.0f) {
-        lastTargetPos = ai->m_target->getPosition();
         activate(ai); // Recalculate path
     }
     
@@ -154,6 +114,9 @@ void StepGoal::activate(HolySwordWolfAI* ai) {
             break;
     }
     
+    if (ai->isDebugEnabled()) {
+        std::cout << "Step Distance: " << stepDistance << std::endl;
+    }
     ai->m_self->performStep(stepDir, stepDistance); // Scale up distance
 }
 
@@ -196,16 +159,15 @@ void SidewayMoveGoal::terminate(HolySwordWolfAI* ai) {
     currentTime = 0;
 }
 
-HolySwordWolfAI::HolySwordWolfAI(Boss* entity, Player* player)
-    : m_self(entity), m_target(player), m_rng(std::random_device{}()),
+HolySwordWolfAI::HolySwordWolfAI(Boss* entity, Player* player, unsigned int seed)
+    : m_self(entity), m_target(player), m_rng(seed),
       m_isEnhanced(false), m_enhancedTimer(0), m_lastDamageTime(0),
       m_isGuardBroken(false), m_actionCooldown(0), m_aggressionLevel(0) {
-    g_sifAI = this;  // Set global pointer for debug access
     m_debugEnabled = false;  // Enable debug by default
 }
 
 // Debug helper function implementations
-std::string HolySwordWolfAI::goalTypeToString(GoalType type) const {
+std::string HolySwordWolfAI::goalTypeToString(GoalType type) {
     switch (type) {
         case GoalType::ATTACK: return "ATTACK";
         case GoalType::MOVE_TO_TARGET: return "MOVE";
@@ -215,29 +177,11 @@ std::string HolySwordWolfAI::goalTypeToString(GoalType type) const {
     }
 }
 
-std::string HolySwordWolfAI::attackTypeToString(AttackType type) const {
-    switch (type) {
-        case AttackType::LIGHT_COMBO_1: return "Light1";
-        case AttackType::LIGHT_COMBO_2: return "Light2";
-        case AttackType::LIGHT_COMBO_3: return "Light3";
-        case AttackType::DASH_ATTACK: return "Dash";
-        case AttackType::DASH_FOLLOWUP: return "DashFollow";
-        case AttackType::SPIN_ATTACK: return "Spin";
-        case AttackType::UPPERCUT: return "Uppercut";
-        case AttackType::BACKSTEP_SLASH_R: return "BackslashR";
-        case AttackType::BACKSTEP_SLASH_L: return "BackslashL";
-        case AttackType::GROUND_SLAM: return "Slam";
-        case AttackType::GROUND_SLAM_FOLLOWUP: return "SlamFollow";
-        case AttackType::PROJECTILE: return "Projectile";
-        case AttackType::ENHANCED_COMBO_1: return "EnhCombo1";
-        case AttackType::ENHANCED_COMBO_2: return "EnhCombo2";
-        case AttackType::ENHANCED_SPIN_R: return "EnhSpinR";
-        case AttackType::ENHANCED_SPIN_L: return "EnhSpinL";
-        default: return "Unknown";
-    }
+std::string HolySwordWolfAI::attackTypeToString(AttackType type) {
+    return AttackTable::isKnown(type) ? AttackTable::attack(type).name : "Unknown";
 }
 
-std::string HolySwordWolfAI::stepTypeToString(StepType type) const {
+std::string HolySwordWolfAI::stepTypeToString(StepType type) {
     switch (type) {
         case StepType::BACKSTEP: return "Backstep";
         case StepType::SIDESTEP_LEFT: return "SideLeft";
@@ -252,7 +196,7 @@ void HolySwordWolfAI::logGoalAddition(const std::string& goalName, const std::st
     GoalDebugInfo info;
     info.goalName = goalName;
     info.reason = reason;
-    info.timestamp = SDL_GetTicks() / 1000.0f;
+    info.timestamp = m_elapsedTime;
     
     m_goalHistory.push_back(info);
     if (m_goalHistory.size() > MAX_HISTORY_SIZE) {
@@ -264,6 +208,24 @@ void HolySwordWolfAI::logGoalAddition(const std::string& goalName, const std::st
               << "] Adding Goal: " << goalName << " | Reason: " << reason << std::endl;
 }
 
+void HolySwordWolfAI::traceGoal(const char* event, AIGoal& goal) {
+    if (!Trace::isEnabled()) return;
+
+    std::string detail = goalTypeToString(goal.getType());
+    if (goal.getType() == GoalType::ATTACK) {
+        detail += " " + attackTypeToString(static_cast<AttackGoal&>(goal).getAttackType());
+    }
+    Trace::instant(event, "ai", detail);
+
+    // Flow arrow from the activating slice to the terminating one
+    if (goal.traceId == 0) {
+        goal.traceId = m_nextTraceId++;
+        Trace::flowStart("Goal", "ai", goal.traceId);
+    } else if (std::string(event) == "GoalTerminate") {
+        Trace::flowEnd("Goal", "ai", goal.traceId);
+    }
+}
+
 void HolySwordWolfAI::updateGoalQueueDebug() {
     if (!m_debugEnabled) return;
     
@@ -324,7 +286,8 @@ void HolySwordWolfAI::update(float deltaTime) {
         m_debugTimer += deltaTime;
     }
     
-    float currentTime = SDL_GetTicks() / 1000.0f;
+    m_elapsedTime += deltaTime;
+    float currentTime = m_elapsedTime;
 
     // Update boss facing direction (smoother rotation)
     if (m_self->canAct() && !m_self->isMoving()) {
@@ -367,7 +330,9 @@ void HolySwordWolfAI::update(float deltaTime) {
                 m_lastAttackTime = currentTime;
             }
 
+            traceGoal("GoalComplete", *m_currentGoal);
             m_currentGoal->terminate(this);
+            traceGoal("GoalTerminate", *m_currentGoal);
             m_currentGoal.reset();
         }
     }
@@ -377,6 +342,7 @@ void HolySwordWolfAI::update(float deltaTime) {
         m_currentGoal = std::move(m_goalQueue.front());
         m_goalQueue.erase(m_goalQueue.begin());
         m_currentGoal->activate(this);
+        traceGoal("GoalActivate", *m_currentGoal);
         if (m_debugEnabled) {
             std::cout << "[AI] Activating next goal: " << goalTypeToString(m_currentGoal->getType()) << std::endl;
         }
@@ -434,7 +400,7 @@ void HolySwordWolfAI::selectAction() {
     float targetDist = getDistanceToTarget();
     float targetHP = getTargetHPRate();
     float selfHP = getSelfHPRate();
-    float timeSinceLastAttack = (SDL_GetTicks() / 1000.0f) - m_lastAttackTime;
+    float timeSinceLastAttack = m_elapsedTime - m_lastAttackTime;
     
     // Action percentages based on distance and state
     // 1-light combo, 2-dash attack, 3-spin attack, 4-Uppercut, 
@@ -669,7 +635,7 @@ void HolySwordWolfAI::selectAction() {
 }
 
 void HolySwordWolfAI::onDamaged(float damage, const Vector2D& sourcePos) {
-    m_lastDamageTime = SDL_GetTicks() / 1000.0f;
+    m_lastDamageTime = m_elapsedTime;
     
     if (m_debugEnabled) {
         std::cout << "[AI] Damaged for " << damage << " HP" << std::endl;
@@ -736,6 +702,7 @@ void HolySwordWolfAI::executeGoal(std::unique_ptr<AIGoal> goal) {
     } else {
         m_currentGoal = std::move(goal);
         m_currentGoal->activate(this);
+        traceGoal("GoalActivate", *m_currentGoal);
     }
 }
 
@@ -747,6 +714,7 @@ void HolySwordWolfAI::clearGoals() {
 
     if (m_currentGoal) {
         m_currentGoal->terminate(this);
+        traceGoal("GoalTerminate", *m_currentGoal);
         m_currentGoal.reset();
     }
     
@@ -7,6 +7,7 @@
 #include <vector>
 #include <cmath>
 #include <deque>
+#include <map>
 #include "Entity.h"
 #include "Goals.h"
 #include "Player.h"
@@ -44,6 +45,9 @@ class HolySwordWolfAI {
     bool m_isEnhanced = false; // Special effect 5401 in the scripts
     float m_enhancedTimer = 0;
     
+    // Simulation clock (advanced by update, independent of wall time)
+    float m_elapsedTime = 0;
+
     // Combat state
     float m_lastDamageTime = 0;
     float m_lastAttackTime = 0;
@@ -60,15 +64,19 @@ class HolySwordWolfAI {
     const float ATTACK_MID = 8.0f;
     const float ATTACK_FAR = 12.0f;
 
+    // Per-fight statistics
+    std::map<AttackType, int> m_attackCounts;  // Attack goals activated, by type
+
+    // Trace ids for goal activate/terminate flow arrows
+    Uint64 m_nextTraceId = 1;
+
     // Debug helper functions
-    std::string goalTypeToString(GoalType type) const;
-    std::string attackTypeToString(AttackType type) const;
-    std::string stepTypeToString(StepType type) const;
     void logGoalAddition(const std::string& goalName, const std::string& reason);
     void updateGoalQueueDebug();
+    void traceGoal(const char* event, AIGoal& goal);
     
 public:
-    HolySwordWolfAI(Boss* entity, Player* player);
+    HolySwordWolfAI(Boss* entity, Player* player, unsigned int seed);
     
     void update(float deltaTime);
     void onDamaged(float damage, const Vector2D& sourcePos);
@@ -105,6 +113,11 @@ public:
     const std::string& getCurrentGoalDebug() const { return m_currentGoalDebug; }
     int getAggressionLevel() const { return m_aggressionLevel; }
     float getActionCooldown() const { return m_actionCooldown; }
+    const std::map<AttackType, int>& getAttackCounts() const { return m_attackCounts; }
+
+    static std::string goalTypeToString(GoalType type);
+    static std::string attackTypeToString(AttackType type);
+    static std::string stepTypeToString(StepType type);
 
     // Movement functions for goals
     void moveToward(const Vector2D& pos, float speed);
@@ -123,6 +136,4 @@ public:
     friend class SidewayMoveGoal;
 };
 
-extern HolySwordWolfAI* g_sifAI;
-
 #endif
@@ -0,0 +1,127 @@
+#include "SpatialHash.h"
+#include <algorithm>
+
+namespace {
+    // Same edge rules as checkCollision in Game.cpp: touching boxes do not overlap
+    bool overlaps(const SDL_Rect& a, const SDL_Rect& b) {
+        return a.x < b.x + b.w &&
+               a.x + a.w > b.x &&
+               a.y < b.y + b.h &&
+               a.y + a.h > b.y;
+    }
+}
+
+SpatialHash::SpatialHash(int cellSize)
+    : m_cellSize(std::max(1, cellSize)), m_columns(1), m_rows(1), m_queryStamp(0) {
+    setBounds(m_cellSize, m_cellSize);
+}
+
+void SpatialHash::setBounds(int width, int height) {
+    m_columns = std::max(1, (width + m_cellSize - 1) / m_cellSize);
+    m_rows = std::max(1, (height + m_cellSize - 1) / m_cellSize);
+    m_cellStart.assign(m_columns * m_rows + 1, 0);
+    m_cellLayers.assign(m_columns * m_rows, 0);
+    m_items.clear();
+    m_cellItems.clear();
+}
+
+void SpatialHash::getCellRange(const SDL_Rect& bounds, int& x0, int& y0, int& x1, int& y1) const {
+    // Floor division, so boxes hanging off the top or left land in the first cells
+    auto cell = [this](int pixel) {
+        return pixel >= 0 ? pixel / m_cellSize : -((-pixel + m_cellSize - 1) / m_cellSize);
+    };
+    x0 = std::max(0, std::min(m_columns - 1, cell(bounds.x)));
+    y0 = std::max(0, std::min(m_rows - 1, cell(bounds.y)));
+    x1 = std::max(0, std::min(m_columns - 1, cell(bounds.x + std::max(0, bounds.w - 1))));
+    y1 = std::max(0, std::min(m_rows - 1, cell(bounds.y + std::max(0, bounds.h - 1))));
+}
+
+void SpatialHash::insert(const SDL_Rect& bounds, Uint32 layer, int id) {
+    m_items.push_back(Item{bounds, layer, id});
+}
+
+void SpatialHash::build() {
+    int cells = m_columns * m_rows;
+    std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+    std::fill(m_cellLayers.begin(), m_cellLayers.end(), 0u);
+
+    // Count the items in each cell, shifted by one so the prefix sum gives start offsets
+    int x0, y0, x1, y1;
+    for (const Item& item : m_items) {
+        getCellRange(item.bounds, x0, y0, x1, y1);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                ++m_cellStart[y * m_columns + x + 1];
+                m_cellLayers[y * m_columns + x] |= item.layer;
+            }
+        }
+    }
+    for (int c = 0; c < cells; ++c) {
+        m_cellStart[c + 1] += m_cellStart[c];
+    }
+
+    // Fill, advancing each cell's start; afterwards m_cellStart[c] is the end of cell c
+    m_cellItems.resize(m_cellStart[cells]);
+    for (int i = 0; i < (int)m_items.size(); ++i) {
+        getCellRange(m_items[i].bounds, x0, y0, x1, y1);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                m_cellItems[m_cellStart[y * m_columns + x]++] = i;
+            }
+        }
+    }
+    // Shift back so m_cellStart[c] is the start of cell c again
+    for (int c = cells; c > 0; --c) {
+        m_cellStart[c] = m_cellStart[c - 1];
+    }
+    m_cellStart[0] = 0;
+
+    m_visited.assign(m_items.size(), 0);
+    m_queryStamp = 0;
+}
+
+void SpatialHash::query(const SDL_Rect& bounds, Uint32 mask, std::vector<int>& ids) {
+    if (++m_queryStamp == 0) {
+        // Stamp wrapped; forget every earlier visit
+        std::fill(m_visited.begin(), m_visited.end(), 0u);
+        m_queryStamp = 1;
+    }
+
+    int x0, y0, x1, y1;
+    getCellRange(bounds, x0, y0, x1, y1);
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            int cell = y * m_columns + x;
+            if (!(m_cellLayers[cell] & mask)) continue;
+
+            for (int k = m_cellStart[cell]; k < m_cellStart[cell + 1]; ++k) {
+                int index = m_cellItems[k];
+                const Item& item = m_items[index];
+                if (!(item.layer & mask) || m_visited[index] == m_queryStamp) continue;
+                m_visited[index] = m_queryStamp;
+                if (overlaps(item.bounds, bounds)) {
+                    ids.push_back(item.id);
+                }
+            }
+        }
+    }
+}
+
+bool SpatialHash::overlapsAny(const SDL_Rect& bounds, Uint32 mask) {
+    int x0, y0, x1, y1;
+    getCellRange(bounds, x0, y0, x1, y1);
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            int cell = y * m_columns + x;
+            if (!(m_cellLayers[cell] & mask)) continue;
+
+            for (int k = m_cellStart[cell]; k < m_cellStart[cell + 1]; ++k) {
+                const Item& item = m_items[m_cellItems[k]];
+                if ((item.layer & mask) && overlaps(item.bounds, bounds)) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
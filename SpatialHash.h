@@ -0,0 +1,60 @@
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// What a collider is, so a query only visits the kinds it can hit
+namespace CollisionLayer {
+    enum : Uint32 {
+        PLAYER_BODY = 1u << 0,
+        BOSS_BODY = 1u << 1,
+        PLAYER_SHOT = 1u << 2,  // Projectiles fired by the player
+        BOSS_SHOT = 1u << 3
+    };
+}
+
+// Uniform-grid broad phase over the arena, in pixels. Colliders are inserted
+// each tick and bucketed by cell with a counting sort, so a rebuild is two
+// linear passes and a query only looks at the cells its box covers.
+// Boxes outside the arena are clamped into the border cells.
+class SpatialHash {
+private:
+    struct Item {
+        SDL_Rect bounds;
+        Uint32 layer;
+        int id;
+    };
+
+    int m_cellSize;
+    int m_columns;
+    int m_rows;
+    std::vector<Item> m_items;
+    std::vector<int> m_cellStart;     // Offsets into m_cellItems, one past the end per cell
+    std::vector<int> m_cellItems;     // Item indices grouped by cell
+    std::vector<Uint32> m_cellLayers; // Union of the layers in each cell, to skip cells early
+    std::vector<Uint32> m_visited;    // Per item, the last query that reported it
+    Uint32 m_queryStamp;
+
+    void getCellRange(const SDL_Rect& bounds, int& x0, int& y0, int& x1, int& y1) const;
+
+public:
+    static const int DEFAULT_CELL_SIZE = 64;
+
+    explicit SpatialHash(int cellSize = DEFAULT_CELL_SIZE);
+
+    void setBounds(int width, int height);  // Arena size in pixels
+
+    // Per tick: clear, insert everything, build, then query
+    void clear() { m_items.clear(); }
+    void insert(const SDL_Rect& bounds, Uint32 layer, int id);
+    void build();
+
+    // Appends the id of every collider on a layer in mask that overlaps bounds, once each
+    void query(const SDL_Rect& bounds, Uint32 mask, std::vector<int>& ids);
+    bool overlapsAny(const SDL_Rect& bounds, Uint32 mask);
+
+    size_t size() const { return m_items.size(); }
+};
+
+#endif
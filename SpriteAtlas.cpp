@@ -0,0 +1,125 @@
+#include "SpriteAtlas.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace {
+    const int ATLAS_WIDTH = 1024;
+    const int PADDING = 1;   // Transparent gap so filtering never samples a neighbour
+
+    // Smallest rect holding every pixel of cell with non-zero alpha; empty if there are none
+    SDL_Rect alphaBounds(const SDL_Surface* surface, const SDL_Rect& cell) {
+        int minX = cell.w, minY = cell.h, maxX = -1, maxY = -1;
+        for (int y = 0; y < cell.h; ++y) {
+            const Uint32* row = reinterpret_cast<const Uint32*>(
+                static_cast<const Uint8*>(surface->pixels) + (size_t)(cell.y + y) * surface->pitch) + cell.x;
+            for (int x = 0; x < cell.w; ++x) {
+                if ((row[x] >> 24) == 0) continue;   // ARGB8888: alpha is the top byte
+                minX = std::min(minX, x);
+                maxX = std::max(maxX, x);
+                minY = std::min(minY, y);
+                maxY = std::max(maxY, y);
+            }
+        }
+        if (maxX < 0) return SDL_Rect{cell.x, cell.y, 0, 0};
+        return SDL_Rect{cell.x + minX, cell.y + minY, maxX - minX + 1, maxY - minY + 1};
+    }
+}
+
+SDL_Surface* SpriteAtlas::pack(SDL_Surface* sheet, int cellWidth, int cellHeight, std::vector<SpriteFrame>& frames) {
+    frames.clear();
+    if (!sheet || cellWidth <= 0 || cellHeight <= 0) return nullptr;
+
+    // Converting to a format with alpha turns colour-keyed pixels transparent
+    SDL_Surface* source = SDL_ConvertSurfaceFormat(sheet, SDL_PIXELFORMAT_ARGB8888, 0);
+    if (!source) return nullptr;
+
+    int columns = source->w / cellWidth;
+    int rows = source->h / cellHeight;
+    if (source->w % cellWidth != 0 || source->h % cellHeight != 0) {
+        std::cerr << "WARNING: Sprite sheet " << source->w << "x" << source->h << " is not a whole number of "
+                  << cellWidth << "x" << cellHeight << " cells; the remainder is dropped" << std::endl;
+    }
+
+    // Trim every cell to its visible pixels
+    std::vector<SDL_Rect> trimmed(columns * rows);
+    if (SDL_MUSTLOCK(source)) SDL_LockSurface(source);
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns; ++column) {
+            SDL_Rect cell = {column * cellWidth, row * cellHeight, cellWidth, cellHeight};
+            trimmed[row * columns + column] = alphaBounds(source, cell);
+        }
+    }
+    if (SDL_MUSTLOCK(source)) SDL_UnlockSurface(source);
+
+    // Shelf packing, tallest frames first so each shelf wastes little height
+    std::vector<int> order(trimmed.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = (int)i;
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return trimmed[a].h > trimmed[b].h; });
+
+    frames.resize(trimmed.size());
+    int penX = 0;
+    int penY = 0;
+    int shelfHeight = 0;
+    for (int index : order) {
+        const SDL_Rect& rect = trimmed[index];
+        SpriteFrame& frame = frames[index];
+        int cellX = (index % columns) * cellWidth;
+        int cellY = (index / columns) * cellHeight;
+        frame.pivotX = cellX + cellWidth / 2 - rect.x;
+        frame.pivotY = cellY + cellHeight / 2 - rect.y;
+        if (rect.w == 0) {
+            frame.source = SDL_Rect{0, 0, 0, 0};
+            continue;
+        }
+
+        if (penX + rect.w > ATLAS_WIDTH) {
+            penX = 0;
+            penY += shelfHeight + PADDING;
+            shelfHeight = 0;
+        }
+        frame.source = SDL_Rect{penX, penY, rect.w, rect.h};
+        penX += rect.w + PADDING;
+        shelfHeight = std::max(shelfHeight, rect.h);
+    }
+
+    SDL_Surface* atlas = SDL_CreateRGBSurfaceWithFormat(0, ATLAS_WIDTH, std::max(1, penY + shelfHeight),
+                                                        32, SDL_PIXELFORMAT_ARGB8888);
+    if (atlas) {
+        SDL_SetSurfaceBlendMode(source, SDL_BLENDMODE_NONE);  // Copy alpha as-is
+        for (size_t i = 0; i < frames.size(); ++i) {
+            if (frames[i].source.w == 0) continue;
+            SDL_Rect from = trimmed[i];
+            SDL_Rect to = frames[i].source;
+            SDL_BlitSurface(source, &from, atlas, &to);
+        }
+    } else {
+        frames.clear();
+    }
+
+    SDL_FreeSurface(source);
+    return atlas;
+}
+
+void SpriteAtlas::writeFrames(const std::vector<SpriteFrame>& frames, std::vector<char>& out) {
+    const char* bytes = reinterpret_cast<const char*>(frames.data());
+    out.insert(out.end(), bytes, bytes + frames.size() * sizeof(SpriteFrame));
+}
+
+bool SpriteAtlas::readFrames(const void* data, size_t size, int atlasWidth, int atlasHeight,
+                             std::vector<SpriteFrame>& frames) {
+    if (size == 0 || size % sizeof(SpriteFrame) != 0) return false;
+    frames.resize(size / sizeof(SpriteFrame));
+    std::memcpy(frames.data(), data, size);
+
+    // Every rect must lie inside the atlas (sums in 64 bits, so nothing wraps)
+    for (const SpriteFrame& frame : frames) {
+        const SDL_Rect& r = frame.source;
+        if (r.x < 0 || r.y < 0 || r.w < 0 || r.h < 0 ||
+            (long long)r.x + r.w > atlasWidth || (long long)r.y + r.h > atlasHeight) {
+            frames.clear();
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,30 @@
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// One animation frame in a packed atlas
+struct SpriteFrame {
+    SDL_Rect source;   // Trimmed frame in the atlas; empty for a fully transparent cell
+    int pivotX;        // Centre of the original cell, relative to source's top-left
+    int pivotY;
+};
+
+// Packs a grid sprite sheet into a dense atlas: every cell is trimmed to the
+// bounds of its visible pixels and the trimmed frames are shelf-packed. The
+// padding around each character no longer takes up texture memory.
+namespace SpriteAtlas {
+    // Trims each cellWidth x cellHeight cell of sheet and packs the results.
+    // Colour-keyed pixels count as transparent. frames gets one entry per cell,
+    // row-major. Returns the ARGB8888 atlas (caller frees), or null.
+    SDL_Surface* pack(SDL_Surface* sheet, int cellWidth, int cellHeight, std::vector<SpriteFrame>& frames);
+
+    // Frame table as a flat blob, for baking into an asset bundle. Reading fails
+    // if any frame's rect falls outside an atlasWidth x atlasHeight texture.
+    void writeFrames(const std::vector<SpriteFrame>& frames, std::vector<char>& out);
+    bool readFrames(const void* data, size_t size, int atlasWidth, int atlasHeight,
+                    std::vector<SpriteFrame>& frames);
+}
+
+#endif
@@ -0,0 +1,53 @@
+#include "SpriteBatch.h"
+#include "FrameCounters.h"
+
+void SpriteBatch::draw(SDL_Texture* texture, int textureWidth, int textureHeight,
+                       const SDL_Rect& source, const SDL_Rect& dest, SDL_Color tint) {
+    if (!texture || textureWidth <= 0 || textureHeight <= 0) return;
+
+    if (m_runs.empty() || m_runs.back().texture != texture) {
+        m_runs.push_back(Run{texture, m_vertices.size(), m_indices.size()});
+    }
+
+    const float inverseWidth = 1.0f / textureWidth;
+    const float inverseHeight = 1.0f / textureHeight;
+    float left = (float)dest.x;
+    float top = (float)dest.y;
+    float right = (float)(dest.x + dest.w);
+    float bottom = (float)(dest.y + dest.h);
+    float u0 = source.x * inverseWidth;
+    float v0 = source.y * inverseHeight;
+    float u1 = (source.x + source.w) * inverseWidth;
+    float v1 = (source.y + source.h) * inverseHeight;
+
+    int base = (int)(m_vertices.size() - m_runs.back().vertexStart);
+    m_vertices.push_back(SDL_Vertex{{left, top}, tint, {u0, v0}});
+    m_vertices.push_back(SDL_Vertex{{right, top}, tint, {u1, v0}});
+    m_vertices.push_back(SDL_Vertex{{right, bottom}, tint, {u1, v1}});
+    m_vertices.push_back(SDL_Vertex{{left, bottom}, tint, {u0, v1}});
+
+    const int quad[6] = {0, 1, 2, 0, 2, 3};
+    for (int corner : quad) {
+        m_indices.push_back(base + corner);
+    }
+}
+
+void SpriteBatch::flush(SDL_Renderer* renderer) {
+    if (m_runs.empty()) return;
+
+    for (size_t i = 0; i < m_runs.size(); ++i) {
+        const Run& run = m_runs[i];
+        bool last = i + 1 == m_runs.size();
+        size_t vertexEnd = last ? m_vertices.size() : m_runs[i + 1].vertexStart;
+        size_t indexEnd = last ? m_indices.size() : m_runs[i + 1].indexStart;
+
+        SDL_RenderGeometry(renderer, run.texture,
+                           &m_vertices[run.vertexStart], (int)(vertexEnd - run.vertexStart),
+                           &m_indices[run.indexStart], (int)(indexEnd - run.indexStart));
+    }
+
+    FrameCounters::addDrawCalls((int)m_runs.size());
+    m_runs.clear();
+    m_vertices.clear();
+    m_indices.clear();
+}
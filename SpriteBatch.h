@@ -0,0 +1,33 @@
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// Collects textured quads with a per-vertex tint, grouped into runs of
+// consecutive submissions from the same texture. flush() draws each run with
+// one SDL_RenderGeometry call, so tinting and fading a sprite never touches
+// the texture's colour or alpha mod.
+class SpriteBatch {
+public:
+    // Copies source (texel rect of a textureWidth x textureHeight texture) to dest
+    void draw(SDL_Texture* texture, int textureWidth, int textureHeight,
+              const SDL_Rect& source, const SDL_Rect& dest, SDL_Color tint);
+
+    // Draws everything queued and empties the batch
+    void flush(SDL_Renderer* renderer);
+    bool empty() const { return m_runs.empty(); }
+
+private:
+    struct Run {
+        SDL_Texture* texture;
+        size_t vertexStart;
+        size_t indexStart;
+    };
+
+    std::vector<Run> m_runs;
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;   // Relative to the owning run's first vertex
+};
+
+#endif
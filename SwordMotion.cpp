@@ -0,0 +1,94 @@
+#include "SwordMotion.h"
+#include "AttackTable.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    using AttackTable::ANIM_COUNT;
+
+    struct Tables {
+        // [anim][side][sample], side 0 is the sword on the right
+        float windup[ANIM_COUNT][2][SwordMotion::CURVE_SAMPLES + 1];
+        float swing[ANIM_COUNT][2][SwordMotion::CURVE_SAMPLES + 1];
+        float circle[SwordMotion::CIRCLE_SAMPLES + 1][2];  // One extra entry so interpolation never wraps
+    };
+
+    // Exact angle of a curve; only used while baking
+    double evaluate(const AttackTable::SwordCurve& curve, int side, float progress, float duration, double spinFrom) {
+        switch (curve.kind) {
+            case AttackTable::CurveKind::LINEAR: {
+                float t = progress;
+                if (curve.hold > 0.0f) {
+                    t = t < curve.hold ? 0.0f : (t - curve.hold) / (1.0f - curve.hold);
+                }
+                return curve.start[side] + curve.sweep[side] * t;
+            }
+            case AttackTable::CurveKind::SPIN:
+                return spinFrom + 2 * M_PI * curve.turns * progress;
+            case AttackTable::CurveKind::WOBBLE:
+                // Driven by the time left in the swing
+                return curve.start[side] + std::sin(duration * (1.0f - progress) * 10) * 0.1f;
+        }
+        return 0.0;
+    }
+
+    float sample(const float* curve, float progress) {
+        float position = std::max(0.0f, std::min(1.0f, progress)) * SwordMotion::CURVE_SAMPLES;
+        int index = std::min(static_cast<int>(position), SwordMotion::CURVE_SAMPLES - 1);
+        float frac = position - index;
+        return curve[index] + (curve[index + 1] - curve[index]) * frac;
+    }
+
+    Tables build() {
+        using SwordMotion::CIRCLE_SAMPLES;
+        using SwordMotion::CURVE_SAMPLES;
+        Tables tables;
+
+        for (int i = 0; i <= CIRCLE_SAMPLES; ++i) {
+            double angle = 2 * M_PI * i / CIRCLE_SAMPLES;
+            tables.circle[i][0] = static_cast<float>(std::cos(angle));
+            tables.circle[i][1] = static_cast<float>(std::sin(angle));
+        }
+
+        for (int anim = 0; anim < ANIM_COUNT; ++anim) {
+            const AttackTable::AnimDef& def = AttackTable::ANIMS[anim];
+            for (int side = 0; side < 2; ++side) {
+                // A spin carries on from wherever the wind-up finished
+                double windupEnd = evaluate(def.windupCurve, side, 1.0f, def.windup, 0.0);
+                for (int i = 0; i <= CURVE_SAMPLES; ++i) {
+                    float progress = static_cast<float>(i) / CURVE_SAMPLES;
+                    tables.windup[anim][side][i] =
+                        static_cast<float>(evaluate(def.windupCurve, side, progress, def.windup, 0.0));
+                    tables.swing[anim][side][i] =
+                        static_cast<float>(evaluate(def.swingCurve, side, progress, def.duration, windupEnd));
+                }
+            }
+        }
+        return tables;
+    }
+
+    // Built on first use; the language guarantees that happens once even when
+    // several batch workers construct their fights at the same time
+    const Tables& tables() {
+        static const Tables baked = build();
+        return baked;
+    }
+}
+
+float SwordMotion::windupAngle(BossAttackAnim anim, bool rightSide, float progress) {
+    return sample(tables().windup[static_cast<int>(anim)][rightSide ? 0 : 1], progress);
+}
+
+float SwordMotion::swingAngle(BossAttackAnim anim, bool rightSide, float progress) {
+    return sample(tables().swing[static_cast<int>(anim)][rightSide ? 0 : 1], progress);
+}
+
+Vector2D SwordMotion::direction(float angle) {
+    float position = angle * static_cast<float>(CIRCLE_SAMPLES / (2 * M_PI));
+    float base = std::floor(position);
+    int index = static_cast<int>(base) & (CIRCLE_SAMPLES - 1);  // Wraps negative angles too
+    float frac = position - base;
+    const float* a = tables().circle[index];
+    const float* b = tables().circle[index + 1];
+    return Vector2D(a[0] + (b[0] - a[0]) * frac, a[1] + (b[1] - a[1]) * frac);
+}
@@ -0,0 +1,23 @@
+#ifndef SWORD_MOTION_H
+#define SWORD_MOTION_H
+
+#include "Boss.h"
+#include "Vector2D.h"
+
+// Boss sword poses baked from AttackTable's curves into small lookup tables,
+// so a tick costs the same two array reads whatever the attack is. The tables
+// are built, once and thread-safely, by the first lookup.
+namespace SwordMotion {
+    const int CURVE_SAMPLES = 64;     // Segments per attack phase, over normalised progress
+    const int CIRCLE_SAMPLES = 1024;  // Entries per turn in the unit-circle table (power of two)
+
+    // Sword angle (radians) at progress in [0, 1] of the wind-up or the swing;
+    // progress outside the range is clamped
+    float windupAngle(BossAttackAnim anim, bool rightSide, float progress);
+    float swingAngle(BossAttackAnim anim, bool rightSide, float progress);
+
+    // (cos, sin) of any angle, interpolated from the unit-circle table
+    Vector2D direction(float angle);
+}
+
+#endif
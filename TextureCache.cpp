@@ -0,0 +1,110 @@
+#include "TextureCache.h"
+#include <iostream>
+
+TextureCache::TextureCache(size_t budgetBytes)
+    : m_budgetBytes(budgetBytes), m_usedBytes(0), m_useClock(0) {}
+
+TextureCache::~TextureCache() {
+    clear();
+}
+
+TextureHandle TextureCache::acquire(const std::string& path) {
+    if (TextureHandle cached = find(path)) {
+        return cached;
+    }
+
+    TextureHandle texture = std::make_shared<LTexture>();
+    if (!texture->loadFromFile(path)) {
+        return nullptr;
+    }
+    return add(path, texture);
+}
+
+TextureHandle TextureCache::insert(const std::string& path, SDL_Surface* surface) {
+    if (TextureHandle cached = find(path)) {
+        return cached;
+    }
+
+    TextureHandle texture = std::make_shared<LTexture>();
+    if (!texture->loadFromSurface(surface)) {
+        std::cerr << "Unable to create texture from " << path << ": " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+    return add(path, texture);
+}
+
+TextureHandle TextureCache::insert(const std::string& path, const void* pixels, int width, int height, int pitch) {
+    if (TextureHandle cached = find(path)) {
+        return cached;
+    }
+
+    TextureHandle texture = std::make_shared<LTexture>();
+    if (!texture->loadFromPixels(pixels, width, height, pitch)) {
+        std::cerr << "Unable to create texture for " << path << ": " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+    return add(path, texture);
+}
+
+TextureHandle TextureCache::find(const std::string& path) {
+    auto it = m_entries.find(path);
+    if (it == m_entries.end()) {
+        return nullptr;
+    }
+    it->second.lastUse = ++m_useClock;
+    return it->second.texture;
+}
+
+TextureHandle TextureCache::add(const std::string& path, const TextureHandle& texture) {
+    Entry entry = {texture, texture->getBytes(), ++m_useClock};
+    m_usedBytes += entry.bytes;
+    m_entries.emplace(path, entry);
+
+    trim();
+    if (m_usedBytes > m_budgetBytes) {
+        std::cerr << "Warning: textures in use exceed the budget (" << m_usedBytes / 1024 << " KB of "
+                  << m_budgetBytes / 1024 << " KB)" << std::endl;
+    }
+    return texture;
+}
+
+void TextureCache::trim() {
+    while (m_usedBytes > m_budgetBytes) {
+        // Only the cache holds an unused texture, so its use count is 1
+        auto oldest = m_entries.end();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->second.texture.use_count() == 1 &&
+                (oldest == m_entries.end() || it->second.lastUse < oldest->second.lastUse)) {
+                oldest = it;
+            }
+        }
+        if (oldest == m_entries.end()) {
+            return;  // Everything left is in use
+        }
+
+        m_usedBytes -= oldest->second.bytes;
+        m_entries.erase(oldest);
+    }
+}
+
+void TextureCache::clear() {
+    m_entries.clear();
+    m_usedBytes = 0;
+}
+
+void TextureCache::setBudget(size_t budgetBytes) {
+    m_budgetBytes = budgetBytes;
+    trim();
+}
+
+void TextureCache::printReport(std::ostream& out) const {
+    out << "=== Texture Cache ===" << std::endl;
+    out << "Textures: " << m_entries.size() << ", " << m_usedBytes / 1024 << " KB of "
+        << m_budgetBytes / 1024 << " KB budget" << std::endl;
+    for (const auto& pair : m_entries) {
+        const Entry& entry = pair.second;
+        out << "  " << pair.first << ": " << entry.texture->getWidth() << "x" << entry.texture->getHeight()
+            << ", " << entry.bytes / 1024 << " KB" << (entry.texture.use_count() > 1 ? "" : " (unused)")
+            << std::endl;
+    }
+}
@@ -0,0 +1,63 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include "LTexture.h"
+#include <SDL2/SDL.h>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+
+typedef std::shared_ptr<LTexture> TextureHandle;
+
+// Textures loaded from disk, keyed by path and shared between users.
+// A texture stays resident while anyone holds its handle. Textures nobody
+// holds are kept for reuse until the total size exceeds the budget, then
+// evicted least recently acquired first.
+class TextureCache {
+public:
+    static const size_t DEFAULT_BUDGET_BYTES = 256 * 1024 * 1024;
+
+    explicit TextureCache(size_t budgetBytes = DEFAULT_BUDGET_BYTES);
+    ~TextureCache();
+
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    // Returns the cached texture for path, loading it on first use; null if loading failed
+    TextureHandle acquire(const std::string& path);
+    // Returns the cached texture for path without loading it; null if not resident
+    TextureHandle find(const std::string& path);
+    // Uploads an image decoded elsewhere and caches it under path; the surface is not freed
+    TextureHandle insert(const std::string& path, SDL_Surface* surface);
+    // Same, from ARGB8888 pixels such as an asset bundle's
+    TextureHandle insert(const std::string& path, const void* pixels, int width, int height, int pitch);
+
+    // Evicts unused textures until the total fits the budget (or nothing unused is left)
+    void trim();
+    // Drops every texture; outstanding handles keep theirs alive until released
+    void clear();
+
+    void setBudget(size_t budgetBytes);
+    size_t getBudget() const { return m_budgetBytes; }
+    size_t getUsedBytes() const { return m_usedBytes; }
+    size_t getTextureCount() const { return m_entries.size(); }
+
+    void printReport(std::ostream& out) const;
+
+private:
+    TextureHandle add(const std::string& path, const TextureHandle& texture);
+
+    struct Entry {
+        TextureHandle texture;
+        size_t bytes;
+        Uint64 lastUse;   // Value of m_useClock at the last acquire
+    };
+
+    std::map<std::string, Entry> m_entries;
+    size_t m_budgetBytes;
+    size_t m_usedBytes;
+    Uint64 m_useClock;
+};
+
+#endif
@@ -0,0 +1,167 @@
+#include "Trace.h"
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+    struct TraceEvent {
+        char phase;           // 'X' complete, 'i' instant, 's'/'f' flow start/end
+        const char* name;
+        const char* category;
+        double timestampUs;
+        double durationUs;
+        Uint64 id;
+        std::string detail;
+    };
+
+    struct ThreadBuffer {
+        int threadId;
+        std::vector<TraceEvent> events;
+    };
+
+    // Buffers outlive their threads so worker events survive until the flush
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+        std::string path;
+        Uint64 startCounter = 0;
+        double usPerCounter = 0.0;
+    };
+
+    std::atomic<bool> s_enabled(false);
+
+    Registry& registry() {
+        static Registry instance;
+        return instance;
+    }
+
+    ThreadBuffer& threadBuffer() {
+        thread_local ThreadBuffer* buffer = nullptr;
+        if (!buffer) {
+            Registry& reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            reg.buffers.push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer()));
+            buffer = reg.buffers.back().get();
+            buffer->threadId = (int)reg.buffers.size();
+            buffer->events.reserve(4096);
+        }
+        return *buffer;
+    }
+
+    double toUs(Uint64 counter) {
+        const Registry& reg = registry();
+        return (double)(counter - reg.startCounter) * reg.usPerCounter;
+    }
+
+    void push(char phase, const char* name, const char* category, double timestampUs,
+              double durationUs, Uint64 id, const std::string& detail) {
+        threadBuffer().events.push_back(TraceEvent{phase, name, category, timestampUs, durationUs, id, detail});
+    }
+
+    void writeEscaped(std::ostream& out, const std::string& text) {
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                out << '\\' << c;
+            } else if ((unsigned char)c < 0x20) {
+                out << ' ';
+            } else {
+                out << c;
+            }
+        }
+    }
+
+    void flushAtExit() {
+        Trace::flush();
+    }
+}
+
+namespace Trace {
+
+void enable(const std::string& path) {
+    Registry& reg = registry();
+    reg.path = path;
+    reg.startCounter = SDL_GetPerformanceCounter();
+    reg.usPerCounter = 1000000.0 / (double)SDL_GetPerformanceFrequency();
+
+    if (!s_enabled.exchange(true)) {
+        std::atexit(flushAtExit);
+    }
+}
+
+bool isEnabled() {
+    return s_enabled.load(std::memory_order_relaxed);
+}
+
+void complete(const char* name, const char* category, Uint64 startCounter, Uint64 endCounter) {
+    if (!isEnabled()) return;
+    double start = toUs(startCounter);
+    push('X', name, category, start, toUs(endCounter) - start, 0, std::string());
+}
+
+void instant(const char* name, const char* category, const std::string& detail) {
+    if (!isEnabled()) return;
+    push('i', name, category, toUs(SDL_GetPerformanceCounter()), 0.0, 0, detail);
+}
+
+void flowStart(const char* name, const char* category, Uint64 id) {
+    if (!isEnabled()) return;
+    push('s', name, category, toUs(SDL_GetPerformanceCounter()), 0.0, id, std::string());
+}
+
+void flowEnd(const char* name, const char* category, Uint64 id) {
+    if (!isEnabled()) return;
+    push('f', name, category, toUs(SDL_GetPerformanceCounter()), 0.0, id, std::string());
+}
+
+bool flush() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    if (reg.path.empty()) return false;
+
+    std::ofstream out(reg.path);
+    if (!out) {
+        std::cerr << "Unable to write trace: " << reg.path << std::endl;
+        return false;
+    }
+
+    size_t eventCount = 0;
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    for (const auto& buffer : reg.buffers) {
+        for (const TraceEvent& event : buffer->events) {
+            if (!first) out << ",\n";
+            first = false;
+            ++eventCount;
+
+            out << "{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category
+                << "\",\"ph\":\"" << event.phase << "\",\"ts\":" << event.timestampUs
+                << ",\"pid\":1,\"tid\":" << buffer->threadId;
+            if (event.phase == 'X') {
+                out << ",\"dur\":" << event.durationUs;
+            } else if (event.phase == 'i') {
+                out << ",\"s\":\"t\"";
+            } else {
+                out << ",\"id\":" << event.id;
+                if (event.phase == 'f') out << ",\"bp\":\"e\"";
+            }
+            if (!event.detail.empty()) {
+                out << ",\"args\":{\"detail\":\"";
+                writeEscaped(out, event.detail);
+                out << "\"}";
+            }
+            out << "}";
+        }
+    }
+    out << "\n]}\n";
+
+    std::cout << "Wrote " << eventCount << " trace events to " << reg.path << std::endl;
+    return (bool)out;
+}
+
+}
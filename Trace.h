@@ -0,0 +1,30 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <SDL2/SDL.h>
+#include <string>
+
+// Opt-in Chrome trace-event recorder (chrome://tracing, ui.perfetto.dev).
+// Each thread appends to its own buffer; all buffers are written as one
+// JSON file when the process exits. Names and categories must be string
+// literals, since only the pointer is stored.
+namespace Trace {
+    // Start collecting; the file is written at exit
+    void enable(const std::string& path);
+    bool isEnabled();
+
+    // Duration event between two SDL performance-counter readings
+    void complete(const char* name, const char* category, Uint64 startCounter, Uint64 endCounter);
+
+    // Point-in-time event on the calling thread, with optional free-form detail
+    void instant(const char* name, const char* category, const std::string& detail = std::string());
+
+    // Arrow from the slice enclosing flowStart to the one enclosing flowEnd with the same id
+    void flowStart(const char* name, const char* category, Uint64 id);
+    void flowEnd(const char* name, const char* category, Uint64 id);
+
+    // Write everything collected so far (called automatically at exit)
+    bool flush();
+}
+
+#endif
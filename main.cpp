@@ -1,60 +1,260 @@
 #include "Game.h"
+#include "BatchSimulator.h"
+#include "InputRecording.h"
+#include "PlayerBot.h"
+#include "Trace.h"
 #include <SDL2/SDL_stdinc.h>
 #include <SDL2/SDL_timer.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
-#include "Timer.h"
+#include <string>
+#include <thread>
 
-int main() {
+static bool saveRecording(const Game& game, const std::string& path) {
+    const InputRecording* recording = game.getRecording();
+    if (!recording || !recording->saveToFile(path)) {
+        return false;
+    }
+    std::cout << "Recorded " << recording->getTickCount() << " ticks (seed " << recording->getSeed()
+              << ") to " << path << ", state checksum " << std::hex << game.getStateChecksum()
+              << std::dec << std::endl;
+    return true;
+}
+
+// Runs fights back to back with no window, no rendering and no frame cap,
+// restarting whenever one side dies, and reports simulation throughput.
+// When recording, only the first fight is run so the log covers all of it.
+static int runHeadless(int width, int height, long long ticks, float fixedStep,
+                       unsigned int seed, PlayerBot::Style botStyle, const std::string& recordPath) {
+    Game game;
+    if (!game.initHeadless(width, height, seed)) {
+        std::cerr << "Failed to initialize headless simulation!" << std::endl;
+        return -1;
+    }
+    if (!recordPath.empty()) {
+        game.startRecording(fixedStep);
+    }
+
+    PlayerBot bot(botStyle, seed);
+    long long fightsFinished = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    long long tick = 0;
+    for (; tick < ticks; ++tick) {
+        game.setPlayerInput(bot.think(*game.getPlayer(), *game.getBoss(), fixedStep));
+        game.update(fixedStep);
+        if (game.isFightOver()) {
+            ++fightsFinished;
+            if (!recordPath.empty()) {
+                ++tick;
+                break;
+            }
+            game.resetFight(seed + (unsigned int)fightsFinished);
+        }
+    }
+    ticks = tick;
+
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double simSeconds = ticks * (double)fixedStep;
+    double ticksPerSecond = wallSeconds > 0 ? ticks / wallSeconds : 0.0;
+
+    std::cout << "=== Headless Simulation ===" << std::endl;
+    std::cout << "Ticks:           " << ticks << " @ " << 1.0f / fixedStep << " Hz" << std::endl;
+    std::cout << "Simulated time:  " << simSeconds << " s" << std::endl;
+    std::cout << "Fights finished: " << fightsFinished << std::endl;
+    std::cout << "Wall time:       " << wallSeconds << " s" << std::endl;
+    std::cout << "Ticks/sec:       " << ticksPerSecond << std::endl;
+    std::cout << "Speed:           " << (wallSeconds > 0 ? simSeconds / wallSeconds : 0.0) << "x real time" << std::endl;
+
+    if (!recordPath.empty() && !saveRecording(game, recordPath)) {
+        return -1;
+    }
+    return 0;
+}
+
+// Feeds a recorded fight back through the simulation as fast as possible.
+// The final checksum matches the one printed when the fight was recorded.
+static int runHeadlessReplay(int width, int height, const InputRecording& recording) {
+    Game game;
+    if (!game.initHeadless(width, height, recording.getSeed())) {
+        std::cerr << "Failed to initialize headless simulation!" << std::endl;
+        return -1;
+    }
+    game.startReplay(recording);
+
+    auto start = std::chrono::steady_clock::now();
+    while (!game.isReplayFinished()) {
+        game.update(recording.getFixedStep());
+    }
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Replayed " << game.getTick() << " ticks (seed " << recording.getSeed() << ") in "
+              << wallSeconds << " s, state checksum " << std::hex << game.getStateChecksum()
+              << std::dec << std::endl;
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
     const int SCREEN_WIDTH = 800;
     const int SCREEN_HEIGHT = 600;
-    const int FPS = 60;  // Increased to 60 FPS for smoother combat
-    const int frameDelay = 1000 / FPS;
-    
+
+    // Simulation runs at a fixed rate; rendering runs as fast as vsync allows
+    float simulationHz = 120.0f;
+    int maxStepsPerFrame = 8;  // Spiral-of-death guard: drop time rather than fall further behind
+
+    bool headless = false;
+    long long headlessTicks = 120 * 60 * 10;  // Ten simulated minutes at the default rate
+
+    int batchFights = 0;
+    int batchThreads = std::max(1u, std::thread::hardware_concurrency());
+    unsigned int seed = 1;
+    PlayerBot::Style botStyle = PlayerBot::Style::CAUTIOUS;
+
+    std::string recordPath;
+    std::string replayPath;
+    long long textureBudgetMB = 0;  // 0 keeps the cache's default
+    std::string bundlePath;         // Empty keeps the default bundle
+    std::string bakeBundlePath;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--sim-hz") == 0 && i + 1 < argc) {
+            simulationHz = std::max(1.0f, (float)std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--max-steps") == 0 && i + 1 < argc) {
+            maxStepsPerFrame = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            headlessTicks = std::max(1LL, std::atoll(argv[++i]));
+        } else if (std::strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+            batchFights = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            batchThreads = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (unsigned int)std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--texture-budget-mb") == 0 && i + 1 < argc) {
+            textureBudgetMB = std::max(1LL, std::atoll(argv[++i]));
+        } else if (std::strcmp(argv[i], "--bundle") == 0 && i + 1 < argc) {
+            bundlePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--bake-bundle") == 0 && i + 1 < argc) {
+            bakeBundlePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            Trace::enable(argv[++i]);
+        } else if (std::strcmp(argv[i], "--bot") == 0 && i + 1 < argc &&
+                   PlayerBot::parseStyle(argv[i + 1], botStyle)) {
+            ++i;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--sim-hz N] [--max-steps N]\n"
+                      << "       [--headless [--ticks N]] [--batch N [--threads N]]\n"
+                      << "       [--seed N] [--bot aggressive|cautious]\n"
+                      << "       [--record FILE | --replay FILE] [--trace FILE]\n"
+                      << "       [--texture-budget-mb N] [--bundle FILE | --bake-bundle FILE]" << std::endl;
+            return -1;
+        }
+    }
+
+    if (!bakeBundlePath.empty()) {
+        return Game::bakeAssetBundle(bakeBundlePath) ? 0 : -1;
+    }
+
+    float fixedStep = 1.0f / simulationHz;
+
+    // A replay must run at the tick length it was recorded with
+    InputRecording replay;
+    if (!replayPath.empty()) {
+        if (!replay.loadFromFile(replayPath)) {
+            return -1;
+        }
+        fixedStep = replay.getFixedStep();
+    }
+
+    if (batchFights > 0) {
+        std::cout << "Running " << batchFights << " fights on " << batchThreads << " threads ("
+                  << PlayerBot::styleName(botStyle) << " bot, seed " << seed << ")" << std::endl;
+        auto start = std::chrono::steady_clock::now();
+        BatchSimulator simulator(batchFights, batchThreads, seed, fixedStep, botStyle);
+        BatchStats stats = simulator.run();
+        double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        BatchSimulator::printReport(stats, wallSeconds);
+        return 0;
+    }
+
+    if (headless && !replayPath.empty()) {
+        return runHeadlessReplay(SCREEN_WIDTH, SCREEN_HEIGHT, replay);
+    }
+    if (headless) {
+        return runHeadless(SCREEN_WIDTH, SCREEN_HEIGHT, headlessTicks, fixedStep, seed, botStyle, recordPath);
+    }
+
     Game game;
-    
+    if (textureBudgetMB > 0) {
+        game.setTextureBudget((size_t)textureBudgetMB * 1024 * 1024);
+    }
+    if (!bundlePath.empty()) {
+        game.setAssetBundle(bundlePath);
+    }
+
     if (!game.init("Dark Souls 2D - Sif Boss Fight", SCREEN_WIDTH, SCREEN_HEIGHT)) {
         std::cerr << "Failed to initialize game!" << std::endl;
         return -1;
     }
-    
-    Timer fpsTimer, capTimer;
-    int countedFrames = 0;
-    Uint32 previousTime = 0;
-    Uint32 currentTime = 0;
-    float deltaTime = 0.0f;
 
-    fpsTimer.start();
-    previousTime = SDL_GetTicks();
+    if (!replayPath.empty()) {
+        game.startReplay(replay);
+    } else if (!recordPath.empty()) {
+        game.startRecording(fixedStep);
+    }
+    bool replayReported = false;
+
+    Profiler& profiler = game.getProfiler();
+    const double counterFrequency = (double)SDL_GetPerformanceFrequency();
+    Uint64 previousCounter = SDL_GetPerformanceCounter();
+    float accumulator = 0.0f;
 
     while (game.isRunning()) {
-        capTimer.start();
+        profiler.beginFrame();
 
-        currentTime = SDL_GetTicks();
-        deltaTime = (currentTime - previousTime) / 1000.0f;
-        previousTime = currentTime;
+        Uint64 currentCounter = SDL_GetPerformanceCounter();
+        float frameTime = (float)((currentCounter - previousCounter) / counterFrequency);
+        previousCounter = currentCounter;
 
-        // Cap delta time to prevent huge jumps (if game was paused, etc.)
-        if (deltaTime > 0.05f) {  // Max 50ms = 20 FPS minimum
-            deltaTime = 0.05f;
+        game.handleEvents();
+
+        accumulator += frameTime;
+        int steps = 0;
+        while (accumulator >= fixedStep && steps < maxStepsPerFrame) {
+            game.update(fixedStep);
+            accumulator -= fixedStep;
+            ++steps;
         }
 
-        // FPS counter (only print every 60 frames to reduce console spam)
-        if (countedFrames % 60 == 0) {
-            float avgFPS = countedFrames / (fpsTimer.getTicks() / 1000.f);
-            std::cout << "FPS: " << avgFPS << std::endl;
+        // Couldn't keep up (stall, breakpoint, window drag): discard the backlog
+        if (steps == maxStepsPerFrame && accumulator >= fixedStep) {
+            accumulator = 0.0f;
+        }
+
+        if (game.isReplayFinished() && !replayReported) {
+            std::cout << "Replay finished after " << game.getTick() << " ticks, state checksum "
+                      << std::hex << game.getStateChecksum() << std::dec << std::endl;
+            replayReported = true;
         }
 
-        game.handleEvents();
-        game.update(deltaTime);
         game.render();
 
-        ++countedFrames;
-        
-        int frameTime = capTimer.getTicks();
-        if (frameDelay > frameTime) {
-            SDL_Delay(frameDelay - frameTime);
-        }
+        profiler.endFrame();
     }
-    
+
+    profiler.dump(std::cout);
+
+    if (!recordPath.empty() && replayPath.empty() && !saveRecording(game, recordPath)) {
+        return -1;
+    }
+
     return 0;
 }